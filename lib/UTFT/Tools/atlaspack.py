@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+"""
+atlaspack.py - Sprite sheet packer for UTFT
+
+Packs a directory of images into one RGB565 atlas bitmap and a region
+table for UTFT::drawAtlasRegion(). Reads the same image files as
+bmpconv.py: PNG, PPM/PGM and ImageConverter 565 C arrays.
+
+Two files are written: a .c file with the atlas and region table, and a
+.h file with a #define for the index of every image and the extern
+declarations. The packing efficiency (image pixels / atlas pixels) is
+printed together with the position of every image.
+
+Examples:
+  atlaspack.py icons/ --name Icons -o Icons.c
+  atlaspack.py icons/ --name Icons --pad 1 --fill F81F --report
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+import bmpconv
+
+IMAGE_EXTS = (".png", ".ppm", ".pgm", ".pnm", ".c")
+
+
+class Image:
+	def __init__(self, name, w, h, pixels):
+		self.name = name
+		self.w = w
+		self.h = h
+		self.pixels = pixels
+		self.x = 0
+		self.y = 0
+
+
+def read_images(path, bg):
+	images = []
+	for fn in sorted(os.listdir(path)):
+		ext = os.path.splitext(fn)[1].lower()
+		if ext not in IMAGE_EXTS:
+			continue
+		full = os.path.join(path, fn)
+		if ext == ".c":
+			_, w, h, pixels = bmpconv.read_c_array(full, None, None)
+		elif ext in (".ppm", ".pgm", ".pnm"):
+			w, h, pixels = bmpconv.read_pnm(full)
+		else:
+			w, h, pixels = bmpconv.read_png(full, bg)
+		images.append(Image(re.sub(r"\W", "_", os.path.splitext(fn)[0]).upper(), w, h, pixels))
+	return images
+
+
+# --- Packing -----------------------------------------------------------------
+
+def skyline_pack(images, width, pad):
+	"""Bottom-left skyline packing. Returns the atlas height, or None."""
+	sky = [(0, 0, width + pad)]	# (x, y, w) segments of the top edge
+	for im in images:
+		w, h = im.w + pad, im.h + pad
+		best = None
+		for i in range(len(sky)):
+			x = sky[i][0]
+			if x + w > width + pad:
+				break
+			y, j, left = 0, i, w
+			while left > 0:
+				y = max(y, sky[j][1])
+				left -= sky[j][2]
+				j += 1
+			if best is None or (y + h, x) < (best[0] + h, best[1]):
+				best = (y, x, i)
+		if best is None:
+			return None
+		y, x, i = best
+		im.x, im.y = x, y
+		new, end = [], x + w
+		for sx, sy, sw in sky:
+			if sx + sw <= x or sx >= end:
+				new.append((sx, sy, sw))
+				continue
+			if sx < x:
+				new.append((sx, sy, x - sx))
+			if sx + sw > end:
+				new.append((end, sy, sx + sw - end))
+		new.append((x, y + h, w))
+		new.sort()
+		merged = [new[0]]
+		for seg in new[1:]:
+			if seg[1] == merged[-1][1] and merged[-1][0] + merged[-1][2] == seg[0]:
+				merged[-1] = (merged[-1][0], seg[1], merged[-1][2] + seg[2])
+			else:
+				merged.append(seg)
+		sky = merged
+	return max(im.y + im.h for im in images)
+
+
+def pack(images, pad, max_width):
+	"""Tries every useful atlas width and keeps the smallest atlas."""
+	images.sort(key=lambda im: (-im.h, -im.w, im.name))
+	area = sum(im.w * im.h for im in images)
+	lo = max(im.w for im in images)
+	hi = max(lo, min(max_width, sum(im.w + pad for im in images)))
+	start = min(hi, max(lo, int(math.sqrt(area)) // 2))
+	best = None
+	for width in range(start, hi + 1):
+		height = skyline_pack(images, width, pad)
+		if height is None:
+			continue
+		used = max(im.x + im.w for im in images)
+		if best is None or used * height < best[0] * best[1]:
+			best = (used, height, [(im.x, im.y) for im in images])
+	for im, (x, y) in zip(images, best[2]):
+		im.x, im.y = x, y
+	images.sort(key=lambda im: im.name)
+	return best[0], best[1]
+
+
+# --- Output ------------------------------------------------------------------
+
+def write_c(path, name, aw, ah, images, fill):
+	atlas = [fill] * (aw * ah)
+	for im in images:
+		if len(im.pixels) != im.w * im.h:
+			sys.exit("%s: %d pixels, expected %dx%d" % (im.name, len(im.pixels), im.w, im.h))
+		for y in range(im.h):
+			atlas[(im.y + y) * aw + im.x:(im.y + y) * aw + im.x + im.w] = im.pixels[y * im.w:(y + 1) * im.w]
+	with open(path, "w") as f:
+		f.write("#if defined(__AVR__)\n")
+		f.write("\t#include <avr/pgmspace.h>\n")
+		f.write("#elif defined(__PIC32MX__)\n")
+		f.write("\t#define PROGMEM\n")
+		f.write("#elif defined(__arm__)\n")
+		f.write("\t#define PROGMEM\n")
+		f.write("#endif\n\n")
+		f.write("// %s.c\n" % name)
+		f.write("// Atlas size\t: %dx%d pixels, %d images\n" % (aw, ah, len(images)))
+		f.write("// Memory usage\t: %d bytes\n\n" % (aw * ah * 2 + (2 + 4 * len(images)) * 2))
+		f.write("const unsigned short %s[%d] PROGMEM={\n" % (name, aw * ah))
+		for i in range(0, len(atlas), 16):
+			f.write(", ".join("0x%04X" % v for v in atlas[i:i + 16]) + ",\n")
+		f.write("};\n\n")
+		f.write("const unsigned short %s_regions[%d] PROGMEM={\n" % (name, 2 + 4 * len(images)))
+		f.write("%d, %d,  // atlas width, regions\n" % (aw, len(images)))
+		for im in images:
+			f.write("%d, %d, %d, %d,  // %s\n" % (im.x, im.y, im.w, im.h, im.name))
+		f.write("};\n")
+
+
+def write_h(path, name, images):
+	guard = "%s_h" % name
+	with open(path, "w") as f:
+		f.write("// %s.h\n" % name)
+		f.write("// Draw with myGLCD.drawAtlasRegion(x, y, %s, %s_regions, <index>);\n\n" % (name, name))
+		f.write("#ifndef %s\n#define %s\n\n" % (guard, guard))
+		prefix = re.sub(r"\W", "_", name).upper()
+		for i, im in enumerate(images):
+			f.write("#define %s_%s\t%d\t// %dx%d\n" % (prefix, im.name, i, im.w, im.h))
+		f.write("\nextern unsigned int %s[];\n" % name)
+		f.write("extern unsigned int %s_regions[];\n" % name)
+		f.write("\n#endif\n")
+
+
+def main():
+	ap = argparse.ArgumentParser(description="Pack a directory of images into a UTFT atlas.")
+	ap.add_argument("input", help="directory with PNG, PPM/PGM or ImageConverter 565 C files")
+	ap.add_argument("-o", "--output", help="C file to write, the header gets the same name with .h")
+	ap.add_argument("--name", help="array name (default: from the directory)")
+	ap.add_argument("--pad", type=int, default=0, help="pixels left between images")
+	ap.add_argument("--fill", default="0000", help="RGB565 color of unused atlas pixels, in hex")
+	ap.add_argument("--max-width", type=int, default=480, help="widest atlas to try")
+	ap.add_argument("--bg", default="000000", help="RRGGBB color behind transparent PNG pixels")
+	ap.add_argument("--report", action="store_true", help="only print the packing report")
+	args = ap.parse_args()
+
+	name = args.name or re.sub(r"\W", "_", os.path.basename(os.path.normpath(args.input)))
+	bg = tuple(int(args.bg[i:i + 2], 16) for i in (0, 2, 4))
+	images = read_images(args.input, bg)
+	if not images:
+		sys.exit("%s: no images found" % args.input)
+
+	aw, ah = pack(images, args.pad, args.max_width)
+	used = sum(im.w * im.h for im in images)
+	separate = sum(im.w * im.h * 2 for im in images)
+	print("%s: %d images in %dx%d, %.1f%% packed, %d bytes (%d bytes as separate arrays)" % (
+		name, len(images), aw, ah, 100.0 * used / (aw * ah), aw * ah * 2 + (2 + 4 * len(images)) * 2, separate))
+	for i, im in enumerate(images):
+		print("  %3d %-24s %4dx%-4d at %d,%d" % (i, im.name, im.w, im.h, im.x, im.y))
+	if aw * ah * 2 > 32767:
+		print("warning: %s is %d bytes, more than an AVR array can hold" % (name, aw * ah * 2), file=sys.stderr)
+
+	if args.output and not args.report:
+		write_c(args.output, name, aw, ah, images, int(args.fill, 16))
+		write_h(os.path.splitext(args.output)[0] + ".h", name, images)
+
+
+if __name__ == "__main__":
+	main()
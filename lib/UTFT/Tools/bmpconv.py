@@ -0,0 +1,409 @@
+#!/usr/bin/env python3
+"""
+bmpconv.py - Compressed bitmap converter for UTFT
+
+Converts images to the compressed bitmap arrays drawn by
+UTFT::drawCompressedBitmap(). Reads PNG, PPM/PGM and the RGB565 C arrays
+or .raw files written by ImageConverter 565.
+
+Every image is encoded as run-length RGB565 and, when it has 256 colors
+or less, as packed 1/2/4/8 bit palette indices and as run-length palette
+indices. The smallest encoding is written unless --format asks for a
+specific one. A table is printed with the size of every encoding, the
+compression ratio against a raw drawBitmap() array and an estimate of
+the time needed to draw it.
+
+Examples:
+  bmpconv.py splash.png -o splash.c
+  bmpconv.py logo.c --array logo --report
+  bmpconv.py frame.raw --size 120x80 --format palette -o frame.c
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+BITMAP_RLE = 1
+BITMAP_PALETTE = 2
+BITMAP_PALETTE_RLE = 3
+BITMAP_RLE_RUN = 0x80
+MAX_PACKET = 128
+
+FORMAT_NAMES = {BITMAP_RLE: "BITMAP_RLE", BITMAP_PALETTE: "BITMAP_PALETTE", BITMAP_PALETTE_RLE: "BITMAP_PALETTE_RLE"}
+
+# Rough cost of drawing on a 16MHz Mega with a 16bit bus, in CPU cycles.
+# These are estimates for comparing encodings, not measurements.
+SETXY_WRITES = 11			# bus writes to set a window on ILI9486
+CYCLES_PER_WRITE = 24		# one LCD_Write_DATA() call, including the flash read
+CYCLES_PER_FILL = 4			# one pixel of a _fast_fill_16() run
+CYCLES_PER_RUN = 60			# setting up a fast fill
+CYCLES_PER_PACKET = 20		# reading and testing a control byte
+CPU_MHZ = 16
+
+
+def rgb565(r, g, b):
+	return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+# --- Readers -----------------------------------------------------------------
+
+def read_png(path, bg):
+	data = open(path, "rb").read()
+	if data[:8] != b"\x89PNG\r\n\x1a\n":
+		sys.exit("%s: not a PNG file" % path)
+	pos, idat, plte, trns = 8, b"", None, None
+	while pos < len(data):
+		length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+		chunk = data[pos + 8:pos + 8 + length]
+		pos += 12 + length
+		if kind == b"IHDR":
+			w, h, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+		elif kind == b"PLTE":
+			plte = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+		elif kind == b"tRNS":
+			trns = chunk
+		elif kind == b"IDAT":
+			idat += chunk
+		elif kind == b"IEND":
+			break
+	if interlace:
+		sys.exit("%s: interlaced PNG files are not supported" % path)
+	channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+	if depth == 16:
+		sys.exit("%s: 16 bit PNG files are not supported" % path)
+	bpp = max(1, channels * depth // 8)
+	stride = (w * channels * depth + 7) // 8
+	raw = zlib.decompress(idat)
+	rows, prev = [], bytearray(stride)
+	for y in range(h):
+		f = raw[y * (stride + 1)]
+		line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+		for i in range(stride):
+			a = line[i - bpp] if i >= bpp else 0
+			b = prev[i]
+			c = prev[i - bpp] if i >= bpp else 0
+			if f == 1:
+				line[i] = (line[i] + a) & 0xFF
+			elif f == 2:
+				line[i] = (line[i] + b) & 0xFF
+			elif f == 3:
+				line[i] = (line[i] + (a + b) // 2) & 0xFF
+			elif f == 4:
+				p = a + b - c
+				pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+				line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+		rows.append(line)
+		prev = line
+	pixels = []
+	for line in rows:
+		if depth < 8:
+			vals = [(line[(x * depth) >> 3] >> (8 - depth - ((x * depth) & 7))) & ((1 << depth) - 1) for x in range(w)]
+		else:
+			vals = None
+		for x in range(w):
+			if ctype == 3:
+				i = vals[x] if vals else line[x]
+				r, g, b = plte[i]
+				a = trns[i] if trns and i < len(trns) else 255
+			elif ctype in (0, 4):
+				v = vals[x] * 255 // ((1 << depth) - 1) if vals else line[x * channels]
+				r = g = b = v
+				a = line[x * 2 + 1] if ctype == 4 else 255
+			else:
+				r, g, b = line[x * channels:x * channels + 3]
+				a = line[x * 4 + 3] if ctype == 6 else 255
+			r = (r * a + bg[0] * (255 - a)) // 255
+			g = (g * a + bg[1] * (255 - a)) // 255
+			b = (b * a + bg[2] * (255 - a)) // 255
+			pixels.append(rgb565(r, g, b))
+	return w, h, pixels
+
+
+def read_pnm(path):
+	data = open(path, "rb").read()
+	fields, pos = [], 2
+	while len(fields) < 3:
+		m = re.compile(rb"\s*(#[^\n]*\n\s*)*(\d+)").match(data, pos)
+		fields.append(int(m.group(2)))
+		pos = m.end()
+	pos += 1
+	w, h, maxval = fields
+	gray = data[:2] == b"P5"
+	if data[:2] not in (b"P5", b"P6") or maxval > 255:
+		sys.exit("%s: only binary 8 bit PGM and PPM files are supported" % path)
+	pixels = []
+	for i in range(w * h):
+		if gray:
+			v = data[pos + i] * 255 // maxval
+			pixels.append(rgb565(v, v, v))
+		else:
+			r, g, b = data[pos + i * 3:pos + i * 3 + 3]
+			pixels.append(rgb565(r * 255 // maxval, g * 255 // maxval, b * 255 // maxval))
+	return w, h, pixels
+
+
+def read_c_array(path, name, size):
+	"""Reads an RGB565 array written by ImageConverter 565."""
+	text = open(path, encoding="latin-1").read()
+	dims = re.search(r"Dimensions\s*:\s*(\d+)\s*x\s*(\d+)", text)
+	text = re.sub(r"//[^\n]*", "", text)
+	text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+	for m in re.finditer(r"(\w+)\s*\[[^\]]*\]\s*(?:PROGMEM\s*)?=\s*\{(.*?)\}", text, re.S):
+		if name and m.group(1) != name:
+			continue
+		pixels = [int(v, 0) & 0xFFFF for v in re.findall(r"0[xX][0-9a-fA-F]+|\d+", m.group(2))]
+		if size:
+			w, h = size
+		elif dims:
+			w, h = int(dims.group(1)), int(dims.group(2))
+		else:
+			sys.exit("%s: no dimensions found, use --size" % path)
+		if len(pixels) != w * h:
+			sys.exit("%s: %s has %d pixels, expected %dx%d" % (path, m.group(1), len(pixels), w, h))
+		return m.group(1), w, h, pixels
+	sys.exit("%s: no bitmap array found" % path)
+
+
+def read_raw(path, size):
+	if not size:
+		sys.exit("%s: raw files need --size" % path)
+	data = open(path, "rb").read()
+	w, h = size
+	if len(data) != w * h * 2:
+		sys.exit("%s: %d bytes, expected %dx%d pixels" % (path, len(data), w, h))
+	return w, h, [data[i * 2] | data[i * 2 + 1] << 8 for i in range(w * h)]
+
+
+# --- Encoders ----------------------------------------------------------------
+
+def header(fmt, bpp, w, h):
+	return [fmt, bpp, w & 0xFF, w >> 8, h & 0xFF, h >> 8]
+
+
+def palette_bytes(palette):
+	out = [len(palette) - 1]
+	for c in palette:
+		out += [c & 0xFF, c >> 8]
+	return out
+
+
+def rle_packets(values):
+	"""Splits values into (is_run, values) packets of at most MAX_PACKET."""
+	packets, lit, i = [], [], 0
+	while i < len(values):
+		n = 1
+		while i + n < len(values) and n < MAX_PACKET and values[i + n] == values[i]:
+			n += 1
+		if n >= 2:
+			if lit:
+				packets.append((False, lit))
+				lit = []
+			packets.append((True, values[i:i + n]))
+		else:
+			lit.append(values[i])
+			if len(lit) == MAX_PACKET:
+				packets.append((False, lit))
+				lit = []
+		i += n
+	if lit:
+		packets.append((False, lit))
+	return packets
+
+
+def encode_rle(values, width):
+	out, packets = [], rle_packets(values)
+	for run, vals in packets:
+		out.append((BITMAP_RLE_RUN if run else 0) | (len(vals) - 1))
+		for v in vals[:1] if run else vals:
+			out += [v & 0xFF, v >> 8] if width == 16 else [v]
+	return out, packets
+
+
+def encode_packed(indices, bpp):
+	out, acc, nbits = [], 0, 0
+	for v in indices:
+		acc = (acc << bpp) | v
+		nbits += bpp
+		if nbits == 8:
+			out.append(acc)
+			acc, nbits = 0, 0
+	if nbits:
+		out.append(acc << (8 - nbits))
+	return out
+
+
+def encodings(w, h, pixels):
+	"""Returns (format, bpp, colors, bytes, packets) for every encoding."""
+	result = []
+	body, packets = encode_rle(pixels, 16)
+	result.append((BITMAP_RLE, 16, 0, header(BITMAP_RLE, 16, w, h) + body, packets))
+	palette = sorted(set(pixels))
+	if len(palette) <= 256:
+		index = {c: i for i, c in enumerate(palette)}
+		indices = [index[c] for c in pixels]
+		bpp = next(b for b in (1, 2, 4, 8) if len(palette) <= 1 << b)
+		data = header(BITMAP_PALETTE, bpp, w, h) + palette_bytes(palette) + encode_packed(indices, bpp)
+		result.append((BITMAP_PALETTE, bpp, len(palette), data, None))
+		body, packets = encode_rle(indices, 8)
+		data = header(BITMAP_PALETTE_RLE, 8, w, h) + palette_bytes(palette) + body
+		result.append((BITMAP_PALETTE_RLE, 8, len(palette), data, packets))
+	return result
+
+
+def decode(data):
+	"""Decodes a compressed bitmap the way UTFT does, as a check."""
+	fmt, bpp = data[0], data[1]
+	w, h = data[2] | data[3] << 8, data[4] | data[5] << 8
+	pos, pal = 6, None
+	if fmt != BITMAP_RLE:
+		n = data[6] + 1
+		pal = [data[7 + i * 2] | data[8 + i * 2] << 8 for i in range(n)]
+		pos = 7 + n * 2
+
+	def pixel(i):
+		if bpp == 16:
+			return data[pos + i * 2] | data[pos + i * 2 + 1] << 8
+		if bpp == 8:
+			return pal[data[pos + i]]
+		b = i * bpp
+		return pal[(data[pos + (b >> 3)] >> (8 - bpp - (b & 7))) & ((1 << bpp) - 1)]
+
+	if fmt == BITMAP_PALETTE:
+		return [pixel(i) for i in range(w * h)]
+	out = []
+	while len(out) < w * h:
+		ctl = data[pos]
+		pos += 1
+		n = (ctl & 0x7F) + 1
+		if ctl & BITMAP_RLE_RUN:
+			out += [pixel(0)] * n
+			pos += bpp // 8
+		else:
+			out += [pixel(i) for i in range(n)]
+			pos += n * bpp // 8
+	return out[:w * h]
+
+
+# --- Report ------------------------------------------------------------------
+
+def draw_cost(fmt, w, h, pixels, packets):
+	"""Estimated bus writes and microseconds to draw through one window."""
+	if packets is None:
+		packets = []
+		for y in range(h):
+			row, x = pixels[y * w:(y + 1) * w], 0
+			while x < w:
+				n = 1
+				while x + n < w and row[x + n] == row[x]:
+					n += 1
+				packets.append((n > 1, row[x:x + n]))
+				x += n
+	writes, cycles = SETXY_WRITES, 0
+	for run, vals in packets:
+		writes += len(vals)
+		cycles += CYCLES_PER_PACKET
+		if run:
+			cycles += CYCLES_PER_RUN + CYCLES_PER_FILL * len(vals)
+		else:
+			cycles += CYCLES_PER_WRITE * len(vals)
+	return writes, cycles / CPU_MHZ
+
+
+def report(name, w, h, pixels, encs, chosen):
+	raw = w * h * 2
+	raw_us = (SETXY_WRITES + w * h) * CYCLES_PER_WRITE / CPU_MHZ
+	print("%s: %dx%d, %s colors, raw drawBitmap() %d bytes, ~%.1f ms" % (
+		name, w, h, len(set(pixels)) if len(set(pixels)) <= 256 else ">256", raw, raw_us / 1000))
+	print("  %-20s %4s %9s %7s %9s %9s %10s" % ("format", "bpp", "bytes", "ratio", "writes", "ms", "Mpixel/s"))
+	for fmt, bpp, colors, data, packets in encs:
+		writes, us = draw_cost(fmt, w, h, pixels, packets)
+		print("  %-20s %4d %9d %6.1fx %9d %9.1f %10.2f %s" % (
+			FORMAT_NAMES[fmt], bpp, len(data), raw / len(data), writes, us / 1000,
+			w * h / us, "<" if (fmt, bpp) == chosen else ""))
+
+
+# --- Output ------------------------------------------------------------------
+
+def write_file(path, name, source, w, h, fmt, bpp, colors, data):
+	with open(path, "w") as f:
+		f.write("#if defined(__AVR__)\n")
+		f.write("\t#include <avr/pgmspace.h>\n")
+		f.write("#elif defined(__PIC32MX__)\n")
+		f.write("\t#define PROGMEM\n")
+		f.write("#elif defined(__arm__)\n")
+		f.write("\t#define PROGMEM\n")
+		f.write("#endif\n\n")
+		f.write("// %s.c\n" % name)
+		f.write("// Generated from\t: %s\n" % os.path.basename(source))
+		f.write("// Dimensions\t\t: %dx%d pixels\n" % (w, h))
+		if colors:
+			f.write("// Format\t\t\t: %s, %d bpp, %d colors\n" % (FORMAT_NAMES[fmt], bpp, colors))
+		else:
+			f.write("// Format\t\t\t: %s\n" % FORMAT_NAMES[fmt])
+		f.write("// Memory usage\t: %d bytes (raw %d bytes)\n" % (len(data), w * h * 2))
+		f.write("//\n// Draw with myGLCD.drawCompressedBitmap(x, y, %s);\n\n" % name)
+		f.write("const unsigned char %s[%d] PROGMEM={\n" % (name, len(data)))
+		f.write(",".join("0x%02X" % v for v in data[:6]) + ",  // header\n")
+		pos = 6
+		if colors:
+			f.write(",".join("0x%02X" % v for v in data[6:7 + colors * 2]) + ",  // palette\n")
+			pos = 7 + colors * 2
+		for i in range(pos, len(data), 16):
+			f.write(",".join("0x%02X" % v for v in data[i:i + 16]) + ",\n")
+		f.write("};\n")
+
+
+def main():
+	ap = argparse.ArgumentParser(description="Convert images to UTFT compressed bitmap arrays.")
+	ap.add_argument("input", help="PNG, PPM/PGM, ImageConverter 565 C array or .raw file")
+	ap.add_argument("-o", "--output", help="C file to write")
+	ap.add_argument("--name", help="array name (default: from input)")
+	ap.add_argument("--array", help="array to use from a C source")
+	ap.add_argument("--size", help="WxH, needed for .raw files")
+	ap.add_argument("--bg", default="000000", help="RRGGBB color behind transparent PNG pixels")
+	ap.add_argument("--format", choices=["auto", "rle", "palette", "palette-rle"], default="auto")
+	ap.add_argument("--report", action="store_true", help="only print the size table")
+	args = ap.parse_args()
+
+	base = re.sub(r"\W", "_", os.path.splitext(os.path.basename(args.input))[0])
+	name = args.name or base
+	size = tuple(int(v) for v in args.size.lower().split("x")) if args.size else None
+	bg = tuple(int(args.bg[i:i + 2], 16) for i in (0, 2, 4))
+	ext = os.path.splitext(args.input)[1].lower()
+	if ext in (".c", ".h", ".cpp"):
+		array, w, h, pixels = read_c_array(args.input, args.array, size)
+		name = args.name or array
+	elif ext == ".raw":
+		w, h, pixels = read_raw(args.input, size)
+	elif ext in (".ppm", ".pgm", ".pnm"):
+		w, h, pixels = read_pnm(args.input)
+	else:
+		w, h, pixels = read_png(args.input, bg)
+	if len(pixels) != w * h:
+		sys.exit("%s: expected %d pixels, found %d" % (args.input, w * h, len(pixels)))
+
+	encs = encodings(w, h, pixels)
+	for fmt, bpp, colors, data, packets in encs:
+		if decode(data) != pixels:
+			sys.exit("internal error: %s does not decode back to the image" % FORMAT_NAMES[fmt])
+	wanted = {"rle": BITMAP_RLE, "palette": BITMAP_PALETTE, "palette-rle": BITMAP_PALETTE_RLE}.get(args.format)
+	if wanted:
+		encs_ok = [e for e in encs if e[0] == wanted]
+		if not encs_ok:
+			sys.exit("%s: more than 256 colors, only rle is possible" % args.input)
+		best = encs_ok[0]
+	else:
+		best = min(encs, key=lambda e: len(e[3]))
+	report(name, w, h, pixels, encs, (best[0], best[1]))
+
+	if len(best[3]) > 32767:
+		print("warning: %s is %d bytes, more than an AVR array can hold" % (name, len(best[3])), file=sys.stderr)
+	if args.output and not args.report:
+		write_file(args.output, name, args.input, w, h, best[0], best[1], best[2], best[3])
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,385 @@
+#!/usr/bin/env python3
+"""
+fontconv.py - Font converter for UTFT
+
+Converts bitmap fonts to UTFT font arrays that can be passed straight to
+UTFT::setFont(). Reads BDF fonts, PSF (version 1 and 2) console fonts and
+the fontdatatype C arrays used by UTFT itself.
+
+The output is a classic UTFT font (offset/numchars header) when the
+selected characters are one contiguous run below 256, and a sparse font
+(code point range table) otherwise. Fonts can be cut down to the
+characters actually used with --chars / --chars-file.
+
+For every font a table is printed with the flash it takes, the bus writes
+and flash reads needed to draw one glyph and the number of color runs per
+glyph. UTFT draws fonts only as raw bitmaps, so that is all this writes.
+Run-length coding the glyphs would not help the fonts that come with it:
+SmallFont would take 3164 bytes instead of 1144 and BigFont 4545 instead
+of 3044. Only the large seven segment fonts, with long runs, would get
+smaller.
+
+Examples:
+  fontconv.py ter-u16b.bdf --name Terminus16 -o Terminus16.c
+  fontconv.py ../DefaultFonts.c --array BigFont --chars "0123456789:" -o BigDigits.c
+  fontconv.py font.psf --chars-file teamnames.txt --format sparse -o TeamFont.c
+  fontconv.py ../DefaultFonts.c --report
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+# Bus writes needed to set a drawing window on ILI9486 and similar
+# controllers: 3 commands and 8 data writes.
+SETXY_WRITES = 11
+
+
+class Font:
+	def __init__(self, name, width, height):
+		self.name = name
+		self.width = width		# always a multiple of 8
+		self.height = height
+		self.glyphs = {}		# code point -> list of row bitmasks, MSB is leftmost
+
+	def row_bytes(self):
+		return self.width // 8
+
+
+# --- Readers -----------------------------------------------------------------
+
+def read_c_arrays(path):
+	"""Returns a Font for every UTFT font array found in a C source file."""
+	text = open(path, encoding="latin-1").read()
+	text = re.sub(r"//[^\n]*", "", text)
+	text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+	fonts = []
+	for m in re.finditer(r"(\w+)\s*\[[^\]]*\]\s*(?:PROGMEM\s*)?=\s*\{(.*?)\}", text, re.S):
+		data = [int(v, 0) for v in re.findall(r"0[xX][0-9a-fA-F]+|\d+", m.group(2))]
+		if len(data) < 5:
+			continue
+		fonts.append(decode_utft(m.group(1), data))
+	return fonts
+
+
+def decode_utft(name, data):
+	width, height, offset, numchars = data[0], data[1], data[2], data[3]
+	font = Font(name, width, height)
+	size = (width // 8) * height
+	if offset == 0 and numchars == 0:
+		nranges = data[4]
+		base = 5 + 6 * nranges
+		for r in range(nranges):
+			first, count, idx = struct.unpack_from("<HHH", bytes(data[5 + 6 * r:11 + 6 * r]))
+			for i in range(count):
+				font.glyphs[first + i] = glyph_rows(data, base + (idx + i) * size, width, height)
+	else:
+		for i in range(numchars):
+			if 4 + (i + 1) * size <= len(data):
+				font.glyphs[offset + i] = glyph_rows(data, 4 + i * size, width, height)
+	return font
+
+
+def glyph_rows(data, pos, width, height):
+	rb = width // 8
+	rows = []
+	for r in range(height):
+		v = 0
+		for b in range(rb):
+			v = (v << 8) | data[pos + r * rb + b]
+		rows.append(v)
+	return rows
+
+
+def read_psf(path, name):
+	raw = open(path, "rb").read()
+	if raw[:2] == b"\x36\x04":
+		mode, charsize = raw[2], raw[3]
+		count = 512 if mode & 0x01 else 256
+		width, height, pos = 8, charsize, 4
+		has_table = mode & 0x06
+		table_pos = pos + count * charsize
+	elif raw[:4] == b"\x72\xb5\x4a\x86":
+		_, hsize, flags, count, charsize, height, width = struct.unpack_from("<7I", raw, 4)
+		pos = hsize
+		has_table = flags & 0x01
+		table_pos = pos + count * charsize
+	else:
+		sys.exit("%s: not a PSF font" % path)
+
+	cell = (width + 7) // 8 * 8
+	font = Font(name, cell, height)
+	src_rb = (width + 7) // 8
+	bitmaps = []
+	for g in range(count):
+		rows = []
+		for r in range(height):
+			v = int.from_bytes(raw[pos + g * charsize + r * src_rb:pos + g * charsize + (r + 1) * src_rb], "big")
+			rows.append(v << (cell - src_rb * 8))
+		bitmaps.append(rows)
+
+	if not has_table:
+		for g in range(count):
+			font.glyphs[g] = bitmaps[g]
+		return font
+
+	p = table_pos
+	for g in range(count):
+		if raw[:2] == b"\x36\x04":
+			while p + 1 < len(raw):
+				cp = struct.unpack_from("<H", raw, p)[0]
+				p += 2
+				if cp == 0xFFFF:
+					break
+				if cp != 0xFFFE:
+					font.glyphs.setdefault(cp, bitmaps[g])
+		else:
+			end = raw.index(b"\xff", p)
+			entry = raw[p:end].split(b"\xfe")[0]
+			p = end + 1
+			for ch in entry.decode("utf-8", "ignore"):
+				font.glyphs.setdefault(ord(ch), bitmaps[g])
+	return font
+
+
+def read_bdf(path, name):
+	lines = open(path, encoding="latin-1").read().splitlines()
+	fbb = None
+	i = 0
+	while i < len(lines) and fbb is None:
+		if lines[i].startswith("FONTBOUNDINGBOX"):
+			fbb = [int(v) for v in lines[i].split()[1:5]]
+		i += 1
+	if fbb is None:
+		sys.exit("%s: no FONTBOUNDINGBOX" % path)
+	fw, fh, fx, fy = fbb
+	font = Font(name, (fw + 7) // 8 * 8, fh)
+
+	cp = None
+	bbx = None
+	while i < len(lines):
+		l = lines[i].split()
+		i += 1
+		if not l:
+			continue
+		if l[0] == "ENCODING":
+			cp = int(l[1])
+		elif l[0] == "BBX":
+			bbx = [int(v) for v in l[1:5]]
+		elif l[0] == "BITMAP":
+			w, h, xo, yo = bbx
+			rows = [0] * fh
+			top = (fh + fy) - (h + yo)
+			shift = xo - fx
+			for r in range(h):
+				bits = lines[i + r].strip()
+				v = int(bits, 16) if bits else 0
+				v >>= len(bits) * 4 - w
+				y = top + r
+				if 0 <= y < fh:
+					left = font.width - w - shift
+					rows[y] = (v << left if left >= 0 else v >> -left) & ((1 << font.width) - 1)
+			i += h
+			if cp is not None and cp >= 0:
+				font.glyphs[cp] = rows
+			cp = None
+	return font
+
+
+# --- Subsetting and output ---------------------------------------------------
+
+def parse_chars(spec):
+	"""Characters as text, with U+XXXX and 0xNN-0xMM ranges allowed."""
+	cps = set()
+	for part in re.split(r"(U\+[0-9A-Fa-f]+(?:-U\+[0-9A-Fa-f]+)?|0x[0-9A-Fa-f]+-0x[0-9A-Fa-f]+)", spec):
+		if re.fullmatch(r"U\+[0-9A-Fa-f]+(-U\+[0-9A-Fa-f]+)?", part):
+			ends = [int(v[2:], 16) for v in part.split("-")]
+			cps.update(range(ends[0], ends[-1] + 1))
+		elif re.fullmatch(r"0x[0-9A-Fa-f]+-0x[0-9A-Fa-f]+", part):
+			a, b = [int(v, 16) for v in part.split("-")]
+			cps.update(range(a, b + 1))
+		else:
+			cps.update(ord(c) for c in part if c not in "\r\n")
+	return cps
+
+
+def subset(font, cps):
+	out = Font(font.name, font.width, font.height)
+	for cp in sorted(cps):
+		if cp in font.glyphs:
+			out.glyphs[cp] = font.glyphs[cp]
+		else:
+			print("warning: %s has no glyph for U+%04X" % (font.name, cp), file=sys.stderr)
+	return out
+
+
+def ranges_of(cps):
+	ranges = []
+	for cp in sorted(cps):
+		if ranges and cp == ranges[-1][0] + ranges[-1][1]:
+			ranges[-1][1] += 1
+		else:
+			ranges.append([cp, 1])
+	return ranges
+
+
+def encode(font, fmt):
+	cps = sorted(font.glyphs)
+	ranges = ranges_of(cps)
+	if fmt == "auto":
+		fmt = "classic" if len(ranges) == 1 and cps[-1] < 256 and len(cps) < 256 else "sparse"
+	if fmt == "classic":
+		first = cps[0]
+		if cps[-1] >= 256 or cps[-1] - first + 1 > 255:
+			sys.exit("%s: characters do not fit a classic font, use --format sparse" % font.name)
+		cps = list(range(first, cps[-1] + 1))
+		header = [font.width, font.height, first, len(cps)]
+	else:
+		header = [font.width, font.height, 0, 0, len(ranges)]
+		idx = 0
+		for first, count in ranges:
+			header += list(struct.pack("<HHH", first, count, idx))
+			idx += count
+	body = []
+	for cp in cps:
+		rows = font.glyphs.get(cp, [0] * font.height)
+		for v in rows:
+			body.append(list(v.to_bytes(font.row_bytes(), "big")))
+	if len(header) + sum(len(b) for b in body) > 65535:
+		print("warning: %s is larger than 64Kb" % font.name, file=sys.stderr)
+	return fmt, header, cps, body
+
+
+def write_c(f, font, fmt, header, cps, body):
+	size = len(header) + sum(len(b) for b in body)
+	rb = font.row_bytes() * font.height
+	f.write("// %s.c\n" % font.name)
+	f.write("// Font Size\t: %dx%d\n" % (font.width, font.height))
+	f.write("// Memory usage\t: %d bytes\n" % size)
+	f.write("// # characters\t: %d\n" % len(cps))
+	if fmt == "sparse":
+		f.write("// Format\t\t: sparse, %d code point ranges\n" % header[4])
+	f.write("\n")
+	f.write("fontdatatype %s[%d] PROGMEM={\n" % (font.name, size))
+	if fmt == "sparse":
+		f.write("0x%02X,0x%02X,0x00,0x00,0x%02X,\n" % tuple(header[:2] + [header[4]]))
+		for r in range(header[4]):
+			t = header[5 + 6 * r:11 + 6 * r]
+			f.write(",".join("0x%02X" % v for v in t) + ",  // U+%04X, %d characters\n" % (t[0] | t[1] << 8, t[2] | t[3] << 8))
+	else:
+		f.write(",".join("0x%02X" % v for v in header) + ",\n")
+	for i, cp in enumerate(cps):
+		glyph = sum(body[i * font.height:(i + 1) * font.height], [])
+		label = chr(cp) if 0x20 < cp < 0x7F else ("<Space>" if cp == 0x20 else "U+%04X" % cp)
+		f.write(",".join("0x%02X" % v for v in glyph) + ",  // %s\n" % label)
+	f.write("};\n")
+
+
+def write_file(path, outputs):
+	with open(path, "w") as f:
+		f.write("#if defined(__AVR__)\n")
+		f.write("\t#include <avr/pgmspace.h>\n")
+		f.write("\t#define fontdatatype const uint8_t\n")
+		f.write("#elif defined(__PIC32MX__)\n")
+		f.write("\t#define PROGMEM\n")
+		f.write("\t#define fontdatatype const unsigned char\n")
+		f.write("#elif defined(__arm__)\n")
+		f.write("\t#define PROGMEM\n")
+		f.write("\t#define fontdatatype const unsigned char\n")
+		f.write("#endif\n\n")
+		for i, args in enumerate(outputs):
+			if i:
+				f.write("\n")
+			write_c(f, *args)
+
+
+# --- Report ------------------------------------------------------------------
+
+def row_runs(v, width):
+	"""Background/foreground runs in a row, starting with background."""
+	runs, color, n = [], 0, 0
+	for b in range(width - 1, -1, -1):
+		bit = (v >> b) & 1
+		if bit == color:
+			n += 1
+		else:
+			runs.append(n)
+			color, n = bit, 1
+	runs.append(n)
+	return runs
+
+
+def report(font, header, body):
+	n = len(font.glyphs)
+	raw = len(header) + sum(len(b) for b in body)
+	runs = 0
+	for rows in font.glyphs.values():
+		runs += sum(len(row_runs(v, font.width)) for v in rows)
+	pixels = font.width * font.height
+	print("%-20s %6dx%-3d %5d %8d %9d %9d %8d %8.1f" % (
+		font.name, font.width, font.height, n, raw,
+		pixels + SETXY_WRITES, pixels + SETXY_WRITES * font.height,
+		font.row_bytes() * font.height, runs / max(n, 1)))
+
+
+def report_header():
+	print("%-20s %10s %5s %8s %9s %9s %8s %8s" % (
+		"font", "size", "chars", "flash",
+		"wr/portr", "wr/landsc", "reads", "runs"))
+	print("%-20s %10s %5s %8s %9s %9s %8s %8s" % (
+		"", "", "", "bytes", "/glyph", "/glyph", "/glyph", "/glyph"))
+
+
+def main():
+	ap = argparse.ArgumentParser(description="Convert bitmap fonts to UTFT font arrays.")
+	ap.add_argument("input", help="BDF, PSF or C source with UTFT font arrays")
+	ap.add_argument("-o", "--output", help="C file to write")
+	ap.add_argument("--name", help="array name (default: from input)")
+	ap.add_argument("--array", action="append", help="only use these arrays from a C source")
+	ap.add_argument("--chars", help="characters to keep, e.g. \"0123456789\" or \"0x20-0x7EÉ\"")
+	ap.add_argument("--chars-file", help="keep the characters used in this UTF-8 text file")
+	ap.add_argument("--format", choices=["auto", "classic", "sparse"], default="auto")
+	ap.add_argument("--report", action="store_true", help="only print the size table")
+	args = ap.parse_args()
+
+	base = re.sub(r"\W", "_", os.path.splitext(os.path.basename(args.input))[0])
+	ext = os.path.splitext(args.input)[1].lower()
+	if ext in (".c", ".h", ".cpp"):
+		fonts = read_c_arrays(args.input)
+		if args.array:
+			fonts = [f for f in fonts if f.name in args.array]
+	elif ext in (".psf", ".psfu"):
+		fonts = [read_psf(args.input, args.name or base)]
+	else:
+		fonts = [read_bdf(args.input, args.name or base)]
+	if not fonts:
+		sys.exit("%s: no fonts found" % args.input)
+	if args.name and len(fonts) == 1:
+		fonts[0].name = args.name
+
+	cps = set()
+	if args.chars:
+		cps |= parse_chars(args.chars)
+	if args.chars_file:
+		cps |= parse_chars(open(args.chars_file, encoding="utf-8").read())
+
+	outputs = []
+	report_header()
+	for font in fonts:
+		if cps:
+			font = subset(font, cps)
+		if not font.glyphs:
+			print("warning: %s has none of the requested characters" % font.name, file=sys.stderr)
+			continue
+		fmt, header, used, body = encode(font, args.format)
+		report(font, header, body)
+		outputs.append((font, fmt, header, used, body))
+
+	if args.output and not args.report:
+		write_file(args.output, outputs)
+
+
+if __name__ == "__main__":
+	main()
@@ -90,20 +90,67 @@
 #endif
 #include "memorysaver.h"
 
+// With UTFT_BUS the bus type's primitives replace the transfer mode tests
+// in LCD_Write_COM(), LCD_Write_DATA() and the fill loops, and pixels in
+// the drawing loops are sent with LCD_PIXEL() without a function call.
+#if defined(UTFT_BUS)
+	#if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
+		#if defined(UTFT_PROFILE)
+			#define LCD_PIXEL(VH, VL)	LCD_Write_DATA(VH, VL)	// So that pixels are counted
+		#else
+			#define LCD_PIXEL(VH, VL)	UTFT_BUS::data(this, VH, VL)
+		#endif
+	#else
+		#error "UTFT_BUS is only supported on the Arduino Mega!"
+	#endif
+#else
+	#define LCD_PIXEL(VH, VL)	LCD_Write_DATA(VH, VL)
+#endif
+
+#include "tft_drivers/drivers.h"
+
+// Drawing before the display is ready is ignored, see updateInitLCD()
+#define RETURN_IF_NOT_READY		if (!_ready) return
+
 UTFT::UTFT()
 {
+	_driver = NULL;
+	_ready = false;
+	_init_pos = NULL;
+	_init_wait = 0;
+#if defined(UTFT_PROFILE)
+	resetProfile();
+#endif
 }
 
-UTFT::UTFT(byte model, int RS, int WR, int CS, int RST, int SER)
-{ 
-	word	dsx[] = {239, 239, 239, 239, 239, 239, 175, 175, 239, 127, 127, 239, 271, 479, 239, 239, 239, 0, 0, 239, 479, 319, 239, 175, 127, 239, 239, 319, 319, 799, 127, 127,239,319,319,319,319,319};
-	word	dsy[] = {319, 399, 319, 319, 319, 319, 219, 219, 399, 159, 127, 319, 479, 799, 319, 319, 319, 0, 0, 319, 799, 479, 319, 219, 159, 319, 319, 479, 479, 479, 159, 159,399,479,479,479,479,479};
-	byte	dtm[] = {16, 16, 16, 8, 8, 16, 8, SERIAL_4PIN, 16, SERIAL_5PIN, SERIAL_5PIN, 16, 16, 16, 8, 16, LATCHED_16, 0, 0, 8, 16, 16, 16, 8, SERIAL_5PIN, SERIAL_5PIN, SERIAL_4PIN, 16, 16, 16, SERIAL_5PIN, SERIAL_5PIN,16,16,16,16,8,8};
+// Called by the constructor with the model's driver descriptor
+void UTFT::_begin(const utft_driver_type *driver, byte model, int RS, int WR, int CS, int RST, int SER)
+{
+	utft_driver_type	d;
 
-	disp_x_size =			dsx[model];
-	disp_y_size =			dsy[model];
-	display_transfer_mode =	dtm[model];
+	if (driver!=NULL)
+	{
+		memcpy_P(&d, driver, sizeof(d));
+		if (d.setxy==NULL)		// Disabled in memorysaver.h
+			driver = NULL;
+	}
+	_driver =				driver;
+	_ready =				false;
+	_init_pos =				NULL;
+	_init_wait =			0;
+	if (driver==NULL)
+		return;
+
+	disp_x_size =			d.x_size;
+	disp_y_size =			d.y_size;
+	display_transfer_mode =	d.transfer_mode;
 	display_model =			model;
+	_setxy =				d.setxy;
+	_hw_spi =				false;
+	_win_valid =			false;
+#if defined(UTFT_PROFILE)
+	resetProfile();
+#endif
 
 	__p1 = RS;
 	__p2 = WR;
@@ -121,6 +168,14 @@ UTFT::UTFT(byte model, int RS, int WR, int CS, int RST, int SER)
 		display_transfer_mode=1;
 		display_serial_mode=SERIAL_5PIN;
 	}
+#if defined(UTFT_BUS)
+	// A model on another bus than UTFT_BUS is treated as unknown
+	if ((UTFT_BUS::mode!=display_transfer_mode) or ((UTFT_BUS::mode==1) and (UTFT_BUS::serial!=display_serial_mode)))
+	{
+		_driver = NULL;
+		return;
+	}
+#endif
 
 	if (display_transfer_mode!=1)
 	{
@@ -176,6 +231,11 @@ void UTFT::LCD_Write_COM(char VL)
 */
 void UTFT::LCD_Write_COM(int VL)  
 {   
+	_win_valid = false;
+	UTFT_PROFILE_ADD(this, com, 1);
+#if defined(UTFT_BUS)
+	UTFT_BUS::com(this, VL);
+#else
 	if (display_transfer_mode!=1)
 	{
 		cbi(P_RS, B_RS);		
@@ -184,11 +244,16 @@ void UTFT::LCD_Write_COM(int VL)
 	else
 
 	LCD_Writ_Bus(0x00,VL,display_transfer_mode);
+#endif
 }
 
 //Write 16Bit add for ILI9486_8 ,ILI9488_8
 void UTFT::LCD_Write_DATA(char VH,char VL)
 {
+	UTFT_PROFILE_ADD(this, data, 1);
+#if defined(UTFT_BUS)
+	UTFT_BUS::data(this, VH, VL);
+#else
 	if (display_transfer_mode!=1)
 	{
 		sbi(P_RS, B_RS);
@@ -205,6 +270,7 @@ void UTFT::LCD_Write_DATA(char VH,char VL)
 		LCD_Writ_Bus(0x01,VH,display_transfer_mode);
 		LCD_Writ_Bus(0x01,VL,display_transfer_mode);
 	}
+#endif
 }
 /*
 void UTFT::LCD_Write_DATA(char VL)
@@ -220,6 +286,10 @@ void UTFT::LCD_Write_DATA(char VL)
 //Write 8Bit
 void UTFT::LCD_Write_DATA(int VL)
 {
+	UTFT_PROFILE_ADD(this, data, 1);
+#if defined(UTFT_BUS)
+	UTFT_BUS::param(this, VL);
+#else
 	if (display_transfer_mode!=1)
 	{
 		sbi(P_RS, B_RS);
@@ -233,6 +303,7 @@ void UTFT::LCD_Write_DATA(int VL)
 	}
 	else
 		LCD_Writ_Bus(0x01,VL,display_transfer_mode);
+#endif
 }
 
 void UTFT::LCD_Write_COM_DATA(char com1,int dat1)
@@ -243,7 +314,44 @@ void UTFT::LCD_Write_COM_DATA(char com1,int dat1)
 
 void UTFT::InitLCD(byte orientation)
 {
-	orient=orientation;
+	UTFT_PROFILE_SCOPE(this, PROFILE_INITLCD);
+	beginInitLCD(orientation);
+	while (!updateInitLCD())
+		delay(_init_wait);
+}
+
+// Starts InitLCD() without waiting for the controller. A controller with
+// an init table is only reset here, its commands and waits are left to
+// updateInitLCD(). The others are initialised here as before.
+void UTFT::beginInitLCD(byte orientation)
+{
+	const uint8_t	*table = NULL;
+	void			(UTFT::*init)();
+
+	UTFT_PROFILE_SCOPE(this, PROFILE_INITLCD);
+	_ready = false;
+	_init_pos = NULL;
+	if (_driver==NULL)
+		return;
+	// Controllers with a MADCTL table are rotated in hardware and drawn
+	// on as PORTRAIT in every orientation. The others can not flip.
+	_rotation = orientation & 3;
+	disp_x_size = pgm_read_word(&_driver->x_size);
+	disp_y_size = pgm_read_word(&_driver->y_size);
+	if (pgm_read_ptr(&_driver->madctl)!=NULL)
+	{
+		if (_rotation & 1)
+			swap(word, disp_x_size, disp_y_size);
+		orient=PORTRAIT;
+	}
+	else
+		orient=_rotation & 1;
+	setColor(255, 255, 255);
+	setBackColor(0, 0, 0);
+	cfont.font=0;
+	cfont.data=0;
+	cfont.lowflash=false;
+	_transparent = false;
 	_hw_special_init();
 
 	pinMode(__p1,OUTPUT);
@@ -256,7 +364,20 @@ void UTFT::InitLCD(byte orientation)
 	if (display_transfer_mode!=1)
 		_set_direction_registers(display_transfer_mode);
 
+	table = (const uint8_t *)pgm_read_ptr(&_driver->init_table);
+
 	sbi(P_RST, B_RST);
+	if (table!=NULL)
+	{
+		cbi(P_RST, B_RST);
+		delayMicroseconds(pgm_read_byte(&table[0]));
+		sbi(P_RST, B_RST);
+		_init_pos = table+INIT_HEADER_SIZE;
+		_init_wait = pgm_read_byte(&table[1]);
+		_init_since = millis();
+		return;
+	}
+
 	delay(50); 
 	cbi(P_RST, B_RST);
 	delay(150);
@@ -265,110 +386,79 @@ void UTFT::InitLCD(byte orientation)
 
 	cbi(P_CS, B_CS);
 
-	switch(display_model)
+	memcpy_P(&init, &_driver->init, sizeof(init));
+	(this->*init)();
+	_set_madctl();
+
+	sbi (P_CS, B_CS); 
+	_ready = true;
+}
+
+// Sends the commands of the init table that are due, up to the next wait
+// (see INIT_DELAY), and returns true once the display can be drawn on.
+// Call it from loop() or a timer tick after beginInitLCD(); until it
+// returns true all drawing functions return without doing anything.
+// Without a driver for the model there is nothing to wait for, so it
+// returns true at once, but the drawing functions still do nothing.
+boolean UTFT::updateInitLCD()
+{
+	byte	com, n, i;
+
+	if (_driver==NULL)
+		return true;
+	if (_init_pos==NULL)
+		return _ready;
+	if (millis()-_init_since<_init_wait)
+		return false;
+
+	UTFT_PROFILE_SCOPE(this, PROFILE_INITLCD);
+	cbi(P_CS, B_CS);
+	for (;;)
 	{
-#ifndef DISABLE_HX8347A
-	#include "tft_drivers/hx8347a/initlcd.h"
-#endif
-#ifndef DISABLE_ILI9327
-	#include "tft_drivers/ili9327/initlcd.h"
-#endif
-#ifndef DISABLE_SSD1289
-	#include "tft_drivers/ssd1289/initlcd.h"
-#endif
-#ifndef DISABLE_ILI9325C
-	#include "tft_drivers/ili9325c/initlcd.h"
-#endif
-#ifndef DISABLE_ILI9325D
-	#include "tft_drivers/ili9325d/default/initlcd.h"
-#endif
-#ifndef DISABLE_ILI9325D_ALT
-	#include "tft_drivers/ili9325d/alt/initlcd.h"
-#endif
-#ifndef DISABLE_HX8340B_8
-	#include "tft_drivers/hx8340b/8/initlcd.h"
-#endif
-#ifndef DISABLE_HX8340B_S
-	#include "tft_drivers/hx8340b/s/initlcd.h"
-#endif
-#ifndef DISABLE_ST7735
-	#include "tft_drivers/st7735/std/initlcd.h"
-#endif
-#ifndef DISABLE_ST7735_ALT
-	#include "tft_drivers/st7735/alt/initlcd.h"
-#endif
-#ifndef DISABLE_PCF8833
-	#include "tft_drivers/pcf8833/initlcd.h"
-#endif
-#ifndef DISABLE_S1D19122
-	#include "tft_drivers/s1d19122/initlcd.h"
-#endif
-#ifndef DISABLE_HX8352A
-	#include "tft_drivers/hx8352a/initlcd.h"
-#endif
-#ifndef DISABLE_SSD1963_480
-	#include "tft_drivers/ssd1963/480/initlcd.h"
-#endif
-#ifndef DISABLE_SSD1963_800
-	#include "tft_drivers/ssd1963/800/initlcd.h"
-#endif
-#ifndef DISABLE_SSD1963_800_ALT
-	#include "tft_drivers/ssd1963/800alt/initlcd.h"
-#endif
-#ifndef DISABLE_S6D1121
-	#include "tft_drivers/s6d1121/initlcd.h"
-#endif
-#ifndef DISABLE_ILI9481
-	#include "tft_drivers/ili9481/initlcd.h"
-#endif
-#ifndef DISABLE_S6D0164
-	#include "tft_drivers/s6d0164/initlcd.h"
-#endif
-#ifndef DISABLE_ST7735S
-	#include "tft_drivers/st7735s/initlcd.h"
-#endif
-#ifndef DISABLE_ILI9341_S4P
-	#include "tft_drivers/ili9341/s4p/initlcd.h"
-#endif
-#ifndef DISABLE_ILI9341_S5P
-	#include "tft_drivers/ili9341/s5p/initlcd.h"
-#endif
-#ifndef DISABLE_R61581
-	#include "tft_drivers/r61581/initlcd.h"
-#endif
-#ifndef DISABLE_ILI9486
-	#include "tft_drivers/ili9486/initlcd.h"
-#endif
-#ifndef DISABLE_HX8357B
-	#include "tft_drivers/HX8357B/initlcd.h"
-#endif
-#ifndef DISABLE_HX8357C
-	#include "tft_drivers/HX8357C/initlcd.h"
-#endif
-#ifndef DISABLE_ILI9488
-	#include "tft_drivers/ILI9488/initlcd.h"
-#endif
-#ifndef DISABLE_CPLD
-	#include "tft_drivers/cpld/initlcd.h"
-#endif
-#ifndef DISABLE_HX8353C
-	#include "tft_drivers/hx8353c/initlcd.h"
-#endif
-#ifndef DISABLE_SPFD5420
-	#include "tft_drivers/SPFD5420/initlcd.h"
-#endif
+		com = pgm_read_byte(_init_pos++);
+		n = pgm_read_byte(_init_pos++);
+		if (n==INIT_STOP)
+		{
+			_set_madctl();
+			_init_pos = NULL;
+			_ready = true;
+			break;
+		}
+		LCD_Write_COM(com);
+		for (i=0; i<(n & ~INIT_DELAY); i++)
+			LCD_Write_DATA(pgm_read_byte(_init_pos++));
+		if (n & INIT_DELAY)
+		{
+			_init_wait = pgm_read_byte(_init_pos++);
+			_init_since = millis();
+			break;
+		}
 	}
+	sbi(P_CS, B_CS);
+	return _ready;
+}
 
-	sbi (P_CS, B_CS); 
+boolean UTFT::ready()
+{
+	return _ready;
+}
 
-	setColor(255, 255, 255);
-	setBackColor(0, 0, 0);
-	cfont.font=0;
-	_transparent = false;
+// Sends the Memory Access Control value for _rotation on controllers that
+// have one, so their address space matches the orientation and setXY()
+// does not have to transform the coordinates.
+void UTFT::_set_madctl()
+{
+	const uint8_t	*madctl = (const uint8_t *)pgm_read_ptr(&_driver->madctl);
+
+	if (madctl==NULL)
+		return;
+	LCD_Write_COM(0x36);
+	LCD_Write_DATA(pgm_read_byte(&madctl[_rotation]));
 }
 
 void UTFT::setXY(word x1, word y1, word x2, word y2)
 {
+	UTFT_PROFILE_ADD(this, setxy, 1);
 	if (orient==LANDSCAPE)
 	{
 		swap(word, x1, y1);
@@ -378,99 +468,43 @@ void UTFT::setXY(word x1, word y1, word x2, word y2)
 		swap(word, y1, y2)
 	}
 
-	switch(display_model)
+	(this->*_setxy)(x1, y1, x2, y2);
+}
+
+// Sets the window on controllers that use the MIPI DCS column (0x2A) and
+// page (0x2B) address commands, leaving out the one that would send the
+// same range again. Any other command sent through LCD_Write_COM() may
+// change what the controller holds, so it clears _win_valid. So does a
+// window set while CS is high, as with clrXY() after most drawing
+// functions: it only reaches modules that have CS tied low.
+void UTFT::_set_window_dcs(word x1, word y1, word x2, word y2)
+{
+	boolean	selected = !(*P_CS & B_CS);
+	boolean	same_x = (selected) and (_win_valid) and (x1==_win_x1) and (x2==_win_x2);
+	boolean	same_y = (selected) and (_win_valid) and (y1==_win_y1) and (y2==_win_y2);
+
+	if (!same_x)
 	{
-#ifndef DISABLE_HX8347A
-	#include "tft_drivers/hx8347a/setxy.h"
-#endif
-#ifndef DISABLE_HX8352A
-	#include "tft_drivers/hx8352a/setxy.h"
-#endif
-#ifndef DISABLE_ILI9327
-	#include "tft_drivers/ili9327/setxy.h"
-#endif
-#ifndef DISABLE_SSD1289
-	#include "tft_drivers/ssd1289/setxy.h"
-#endif
-#ifndef DISABLE_ILI9325C
-	#include "tft_drivers/ili9325c/setxy.h"
-#endif
-#ifndef DISABLE_ILI9325D
-	#include "tft_drivers/ili9325d/default/setxy.h"
-#endif
-#ifndef DISABLE_ILI9325D_ALT
-	#include "tft_drivers/ili9325d/alt/setxy.h"
-#endif
-#ifndef DISABLE_HX8340B_8
-	#include "tft_drivers/hx8340b/8/setxy.h"
-#endif
-#ifndef DISABLE_HX8340B_S
-	#include "tft_drivers/hx8340b/s/setxy.h"
-#endif
-#ifndef DISABLE_ST7735
-	#include "tft_drivers/st7735/std/setxy.h"
-#endif
-#ifndef DISABLE_ST7735_ALT
-	#include "tft_drivers/st7735/alt/setxy.h"
-#endif
-#ifndef DISABLE_S1D19122
-	#include "tft_drivers/s1d19122/setxy.h"
-#endif
-#ifndef DISABLE_PCF8833
-	#include "tft_drivers/pcf8833/setxy.h"
-#endif
-#ifndef DISABLE_SSD1963_480
-	#include "tft_drivers/ssd1963/480/setxy.h"
-#endif
-#ifndef DISABLE_SSD1963_800
-	#include "tft_drivers/ssd1963/800/setxy.h"
-#endif
-#ifndef DISABLE_SSD1963_800_ALT
-	#include "tft_drivers/ssd1963/800alt/setxy.h"
-#endif
-#ifndef DISABLE_S6D1121
-	#include "tft_drivers/s6d1121/setxy.h"
-#endif
-#ifndef DISABLE_ILI9481
-	#include "tft_drivers/ili9481/setxy.h"
-#endif
-#ifndef DISABLE_S6D0164
-	#include "tft_drivers/s6d0164/setxy.h"
-#endif
-#ifndef DISABLE_ST7735S
-	#include "tft_drivers/st7735s/setxy.h"
-#endif
-#ifndef DISABLE_ILI9341_S4P
-	#include "tft_drivers/ili9341/s4p/setxy.h"
-#endif
-#ifndef DISABLE_ILI9341_S5P
-	#include "tft_drivers/ili9341/s5p/setxy.h"
-#endif
-#ifndef DISABLE_R61581
-	#include "tft_drivers/r61581/setxy.h"
-#endif
-#ifndef DISABLE_ILI9486
-	#include "tft_drivers/ili9486/setxy.h"
-#endif
-#ifndef DISABLE_HX8357B
-	#include "tft_drivers/HX8357B/setxy.h"
-#endif
-#ifndef DISABLE_HX8357C
-	#include "tft_drivers/HX8357C/setxy.h"
-#endif
-#ifndef DISABLE_ILI9488
-	#include "tft_drivers/ILI9488/setxy.h"
-#endif
-#ifndef DISABLE_CPLD
-	#include "tft_drivers/cpld/setxy.h"
-#endif
-#ifndef DISABLE_HX8353C
-	#include "tft_drivers/hx8353c/setxy.h"
-#endif
-#ifndef DISABLE_SPFD5420
-	#include "tft_drivers/SPFD5420/setxy.h"
-#endif
+		LCD_Write_COM(0x2a); 
+		LCD_Write_DATA(x1>>8);
+		LCD_Write_DATA(x1);
+		LCD_Write_DATA(x2>>8);
+		LCD_Write_DATA(x2);
+	}
+	if (!same_y)
+	{
+		LCD_Write_COM(0x2b); 
+		LCD_Write_DATA(y1>>8);
+		LCD_Write_DATA(y1);
+		LCD_Write_DATA(y2>>8);
+		LCD_Write_DATA(y2);
 	}
+	LCD_Write_COM(0x2c); 
+	_win_x1 = x1;
+	_win_y1 = y1;
+	_win_x2 = x2;
+	_win_y2 = y2;
+	_win_valid = selected;
 }
 
 void UTFT::clrXY()
@@ -483,6 +517,8 @@ void UTFT::clrXY()
 
 void UTFT::drawRect(int x1, int y1, int x2, int y2)
 {
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_DRAWRECT);
 	if (x1>x2)
 	{
 		swap(int, x1, x2);
@@ -500,6 +536,8 @@ void UTFT::drawRect(int x1, int y1, int x2, int y2)
 
 void UTFT::drawRoundRect(int x1, int y1, int x2, int y2)
 {
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_DRAWRECT);
 	if (x1>x2)
 	{
 		swap(int, x1, x2);
@@ -523,6 +561,8 @@ void UTFT::drawRoundRect(int x1, int y1, int x2, int y2)
 
 void UTFT::fillRect(int x1, int y1, int x2, int y2)
 {
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_FILLRECT);
 	if (x1>x2)
 	{
 		swap(int, x1, x2);
@@ -531,6 +571,12 @@ void UTFT::fillRect(int x1, int y1, int x2, int y2)
 	{
 		swap(int, y1, y2);
 	}
+#if defined(UTFT_BUS)
+	cbi(P_CS, B_CS);
+	setXY(x1, y1, x2, y2);
+	_bus_fill<UTFT_BUS>(this, fch, fcl, (long(x2-x1)+1)*(long(y2-y1)+1));
+	sbi(P_CS, B_CS);
+#else
 	if (display_transfer_mode==16)
 	{
 		cbi(P_CS, B_CS);
@@ -566,10 +612,13 @@ void UTFT::fillRect(int x1, int y1, int x2, int y2)
 			}
 		}
 	}
+#endif
 }
 
 void UTFT::fillRoundRect(int x1, int y1, int x2, int y2)
 {
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_FILLRECT);
 	if (x1>x2)
 	{
 		swap(int, x1, x2);
@@ -603,6 +652,8 @@ void UTFT::fillRoundRect(int x1, int y1, int x2, int y2)
 
 void UTFT::drawCircle(int x, int y, int radius)
 {
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_DRAWCIRCLE);
 	int f = 1 - radius;
 	int ddF_x = 1;
 	int ddF_y = -2 * radius;
@@ -611,13 +662,13 @@ void UTFT::drawCircle(int x, int y, int radius)
  
 	cbi(P_CS, B_CS);
 	setXY(x, y + radius, x, y + radius);
-	LCD_Write_DATA(fch,fcl);
+	LCD_PIXEL(fch,fcl);
 	setXY(x, y - radius, x, y - radius);
-	LCD_Write_DATA(fch,fcl);
+	LCD_PIXEL(fch,fcl);
 	setXY(x + radius, y, x + radius, y);
-	LCD_Write_DATA(fch,fcl);
+	LCD_PIXEL(fch,fcl);
 	setXY(x - radius, y, x - radius, y);
-	LCD_Write_DATA(fch,fcl);
+	LCD_PIXEL(fch,fcl);
  
 	while(x1 < y1)
 	{
@@ -631,21 +682,21 @@ void UTFT::drawCircle(int x, int y, int radius)
 		ddF_x += 2;
 		f += ddF_x;    
 		setXY(x + x1, y + y1, x + x1, y + y1);
-		LCD_Write_DATA(fch,fcl);
+		LCD_PIXEL(fch,fcl);
 		setXY(x - x1, y + y1, x - x1, y + y1);
-		LCD_Write_DATA(fch,fcl);
+		LCD_PIXEL(fch,fcl);
 		setXY(x + x1, y - y1, x + x1, y - y1);
-		LCD_Write_DATA(fch,fcl);
+		LCD_PIXEL(fch,fcl);
 		setXY(x - x1, y - y1, x - x1, y - y1);
-		LCD_Write_DATA(fch,fcl);
+		LCD_PIXEL(fch,fcl);
 		setXY(x + y1, y + x1, x + y1, y + x1);
-		LCD_Write_DATA(fch,fcl);
+		LCD_PIXEL(fch,fcl);
 		setXY(x - y1, y + x1, x - y1, y + x1);
-		LCD_Write_DATA(fch,fcl);
+		LCD_PIXEL(fch,fcl);
 		setXY(x + y1, y - x1, x + y1, y - x1);
-		LCD_Write_DATA(fch,fcl);
+		LCD_PIXEL(fch,fcl);
 		setXY(x - y1, y - x1, x - y1, y - x1);
-		LCD_Write_DATA(fch,fcl);
+		LCD_PIXEL(fch,fcl);
 	}
 	sbi(P_CS, B_CS);
 	clrXY();
@@ -653,6 +704,8 @@ void UTFT::drawCircle(int x, int y, int radius)
 
 void UTFT::fillCircle(int x, int y, int radius)
 {
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_FILLCIRCLE);
 	for(int y1=-radius; y1<=0; y1++) 
 		for(int x1=-radius; x1<=0; x1++)
 			if(x1*x1+y1*y1 <= radius*radius) 
@@ -665,84 +718,33 @@ void UTFT::fillCircle(int x, int y, int radius)
 
 void UTFT::clrScr()
 {
-	long i;
-	
-	cbi(P_CS, B_CS);
-	clrXY();
-	if (display_transfer_mode!=1)
-		sbi(P_RS, B_RS);
-	if (display_transfer_mode==16)
-		_fast_fill_16(0,0,((disp_x_size+1)*(disp_y_size+1)));
-	else if (display_transfer_mode==8)
-		_fast_fill_8(0,((disp_x_size+1)*(disp_y_size+1)));
-	else
-	{
-		for (i=0; i<((disp_x_size+1)*(disp_y_size+1)); i++)
-		{
-			if (display_transfer_mode!=1)
-			{
-					if(display_transfer_mode==8)//add
-				{
-					LCD_Writ_Bus(0,0,display_transfer_mode);
-					LCD_Writ_Bus(0,0,display_transfer_mode);
-				}
-				else
-				LCD_Writ_Bus(0,0,display_transfer_mode);
-				
-			}
-			else
-			{
-				LCD_Writ_Bus(1,0,display_transfer_mode);
-				LCD_Writ_Bus(1,0,display_transfer_mode);
-			}
-		}
-	}
-	sbi(P_CS, B_CS);
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_CLRSCR);
+	_fill_screen(0, 0, getDisplayXSize(), getDisplayYSize());
 }
 
 void UTFT::fillScr(byte r, byte g, byte b)
 {
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_FILLSCR);
 	word color = ((r&248)<<8 | (g&252)<<3 | (b&248)>>3);
 	fillScr(color);
 }
 
 void UTFT::fillScr(word color)
 {
-	long i;
-	char ch, cl;
-	
-	ch=byte(color>>8);
-	cl=byte(color & 0xFF);
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_FILLSCR);
+	_fill_screen(byte(color>>8), byte(color & 0xFF), getDisplayXSize(), getDisplayYSize());
+}
 
+// Fills the whole w x h screen with one color, for clrScr() and fillScr().
+// UTFT_Panel passes its size as constants.
+void UTFT::_fill_screen(byte ch, byte cl, int w, int h)
+{
 	cbi(P_CS, B_CS);
-	clrXY();
-	if (display_transfer_mode!=1)
-		sbi(P_RS, B_RS);
-	if (display_transfer_mode==16)
-		_fast_fill_16(ch,cl,((disp_x_size+1)*(disp_y_size+1)));
-	else if ((display_transfer_mode==8) and (ch==cl))
-		_fast_fill_8(ch,((disp_x_size+1)*(disp_y_size+1)));
-	else
-	{
-		for (i=0; i<((disp_x_size+1)*(disp_y_size+1)); i++)
-		{
-			if (display_transfer_mode!=1)
-			{
-					if(display_transfer_mode==8)//add for ILI9488_8
-				{
-					LCD_Writ_Bus(0,ch,display_transfer_mode);
-					LCD_Writ_Bus(0,cl,display_transfer_mode);
-				}
-				else
-				LCD_Writ_Bus(ch,cl,display_transfer_mode);
-			}
-			else
-			{
-				LCD_Writ_Bus(1,ch,display_transfer_mode);
-				LCD_Writ_Bus(1,cl,display_transfer_mode);
-			}
-		}
-	}
+	setXY(0, 0, w-1, h-1);
+	_fast_fill_run(ch, cl, long(w)*h);
 	sbi(P_CS, B_CS);
 }
 
@@ -789,11 +791,51 @@ word UTFT::getBackColor()
 
 void UTFT::setPixel(word color)
 {
-	LCD_Write_DATA((color>>8),(color&0xFF));	// rrrrrggggggbbbbb
+	LCD_PIXEL((color>>8),(color&0xFF));	// rrrrrggggggbbbbb
+}
+
+// Sends exactly pix pixels of one color into the current window.
+// _fast_fill_16() and _fast_fill_8() send one pixel too many when pix is
+// not a multiple of 16, which is harmless for a full window but not for a
+// run in the middle of a glyph or bitmap.
+void UTFT::_fast_fill_run(byte ch, byte cl, long pix)
+{
+#if defined(UTFT_BUS)
+	_bus_fill<UTFT_BUS>(this, ch, cl, pix);
+#else
+	if (pix<=0)
+		return;
+
+	if ((display_transfer_mode==16) or ((display_transfer_mode==8) and (ch==cl)))
+	{
+		if ((pix % 16)==1)
+		{
+			LCD_Write_DATA(ch,cl);
+			pix--;
+		}
+		if (pix>0)
+		{
+			sbi(P_RS, B_RS);
+			if ((pix % 16)!=0)
+				pix--;
+			if (display_transfer_mode==16)
+				_fast_fill_16(ch,cl,pix);
+			else
+				_fast_fill_8(ch,pix);
+		}
+	}
+	else
+	{
+		for (long i=0; i<pix; i++)
+			LCD_Write_DATA(ch,cl);
+	}
+#endif
 }
 
 void UTFT::drawPixel(int x, int y)
 {
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_DRAWPIXEL);
 	cbi(P_CS, B_CS);
 	setXY(x, y, x, y);
 	setPixel((fch<<8)|fcl);
@@ -803,6 +845,8 @@ void UTFT::drawPixel(int x, int y)
 
 void UTFT::drawLine(int x1, int y1, int x2, int y2)
 {
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_DRAWLINE);
 	if (y1==y2)
 		drawHLine(x1, y1, x2-x1);
 	else if (x1==x2)
@@ -866,6 +910,9 @@ void UTFT::drawHLine(int x, int y, int l)
 	}
 	cbi(P_CS, B_CS);
 	setXY(x, y, x+l, y);
+#if defined(UTFT_BUS)
+	_bus_fill<UTFT_BUS>(this, fch, fcl, l+1);
+#else
 	if (display_transfer_mode == 16)
 	{
 		sbi(P_RS, B_RS);
@@ -880,9 +927,10 @@ void UTFT::drawHLine(int x, int y, int l)
 	{
 		for (int i=0; i<l+1; i++)
 		{
-			LCD_Write_DATA(fch, fcl);
+			LCD_PIXEL(fch, fcl);
 		}
 	}
+#endif
 	sbi(P_CS, B_CS);
 	clrXY();
 }
@@ -896,6 +944,9 @@ void UTFT::drawVLine(int x, int y, int l)
 	}
 	cbi(P_CS, B_CS);
 	setXY(x, y, x, y+l);
+#if defined(UTFT_BUS)
+	_bus_fill<UTFT_BUS>(this, fch, fcl, l+1);
+#else
 	if (display_transfer_mode == 16)
 	{
 		sbi(P_RS, B_RS);
@@ -910,19 +961,35 @@ void UTFT::drawVLine(int x, int y, int l)
 	{
 		for (int i=0; i<l+1; i++)
 		{
-			LCD_Write_DATA(fch, fcl);
+			LCD_PIXEL(fch, fcl);
 		}
 	}
+#endif
 	sbi(P_CS, B_CS);
 	clrXY();
 }
 
-void UTFT::printChar(byte c, int x, int y)
+void UTFT::printChar(word c, int x, int y)
 {
 	byte i,ch;
 	word j;
 	word temp; 
 
+	temp=_glyph_offset(c);
+	if (temp==0)
+	{
+		// Characters missing from the font are drawn as an empty cell
+		if (!_transparent)
+		{
+			cbi(P_CS, B_CS);
+			setXY(x,y,x+cfont.x_size-1,y+cfont.y_size-1);
+			_fast_fill_run(bch,bcl,long(cfont.x_size)*cfont.y_size);
+			sbi(P_CS, B_CS);
+			clrXY();
+		}
+		return;
+	}
+
 	cbi(P_CS, B_CS);
   
 	if (!_transparent)
@@ -931,10 +998,9 @@ void UTFT::printChar(byte c, int x, int y)
 		{
 			setXY(x,y,x+cfont.x_size-1,y+cfont.y_size-1);
 	  
-			temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
 			for(j=0;j<((cfont.x_size/8)*cfont.y_size);j++)
 			{
-				ch=pgm_read_byte(&cfont.font[temp]);
+				ch=fontbyte(temp);
 				for(i=0;i<8;i++)
 				{   
 					if((ch&(1<<(7-i)))!=0)   
@@ -951,14 +1017,12 @@ void UTFT::printChar(byte c, int x, int y)
 		}
 		else
 		{
-			temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
-
 			for(j=0;j<((cfont.x_size/8)*cfont.y_size);j+=(cfont.x_size/8))
 			{
 				setXY(x,y+(j/(cfont.x_size/8)),x+cfont.x_size-1,y+(j/(cfont.x_size/8)));
 				for (int zz=(cfont.x_size/8)-1; zz>=0; zz--)
 				{
-					ch=pgm_read_byte(&cfont.font[temp+zz]);
+					ch=fontbyte(temp+zz);
 					for(i=0;i<8;i++)
 					{   
 						if((ch&(1<<i))!=0)   
@@ -977,12 +1041,11 @@ void UTFT::printChar(byte c, int x, int y)
 	}
 	else
 	{
-		temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
 		for(j=0;j<cfont.y_size;j++) 
 		{
 			for (int zz=0; zz<(cfont.x_size/8); zz++)
 			{
-				ch=pgm_read_byte(&cfont.font[temp+zz]); 
+				ch=fontbyte(temp+zz); 
 				for(i=0;i<8;i++)
 				{   
 					setXY(x+i+(zz*8),y+j,x+i+(zz*8)+1,y+j+1);
@@ -1001,7 +1064,65 @@ void UTFT::printChar(byte c, int x, int y)
 	clrXY();
 }
 
-void UTFT::rotateChar(byte c, int x, int y, int pos, int deg)
+// Draws a character enlarged by an integer factor. Each run of equal
+// pixels in a font row becomes one filled window, so the cost grows with
+// the number of runs rather than with the number of pixels.
+void UTFT::printCharScaled(word c, int x, int y, byte scale)
+{
+	byte	xb = cfont.x_size/8;
+	byte	ch = 0;
+	byte	col, start;
+	boolean	on;
+	word	temp;
+
+	temp=_glyph_offset(c);
+	if (temp==0)
+	{
+		if (!_transparent)
+		{
+			cbi(P_CS, B_CS);
+			setXY(x, y, x+(cfont.x_size*scale)-1, y+(cfont.y_size*scale)-1);
+			_fast_fill_run(bch, bcl, long(cfont.x_size)*cfont.y_size*scale*scale);
+			sbi(P_CS, B_CS);
+			clrXY();
+		}
+		return;
+	}
+
+	cbi(P_CS, B_CS);
+
+	for (byte row=0; row<cfont.y_size; row++)
+	{
+		col = 0;
+		while (col<cfont.x_size)
+		{
+			if ((col % 8)==0)
+				ch=fontbyte(temp+(col/8));
+			on = ((ch & (0x80>>(col % 8)))!=0);
+			start = col;
+			while ((col<cfont.x_size) and (((ch & (0x80>>(col % 8)))!=0)==on))
+			{
+				col++;
+				if (((col % 8)==0) and (col<cfont.x_size))
+					ch=fontbyte(temp+(col/8));
+			}
+			if (on or !_transparent)
+			{
+				setXY(x+(start*scale), y+(row*scale), x+(col*scale)-1, y+(row*scale)+scale-1);
+				if (on)
+					_fast_fill_run(fch, fcl, long(col-start)*scale*scale);
+				else
+					_fast_fill_run(bch, bcl, long(col-start)*scale*scale);
+			}
+		}
+		temp+=xb;
+	}
+
+	sbi(P_CS, B_CS);
+	clrXY();
+}
+
+void UTFT::rotateChar(word c, int x, int y, int pos, int deg)
 {
 	byte i,j,ch;
 	word temp; 
@@ -1009,14 +1130,17 @@ void UTFT::rotateChar(byte c, int x, int y, int pos, int deg)
 	double radian;
 	radian=deg*0.0175;  
 
+	temp=_glyph_offset(c);
+	if (temp==0)
+		return;
+
 	cbi(P_CS, B_CS);
 
-	temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
 	for(j=0;j<cfont.y_size;j++) 
 	{
 		for (int zz=0; zz<(cfont.x_size/8); zz++)
 		{
-			ch=pgm_read_byte(&cfont.font[temp+zz]); 
+			ch=fontbyte(temp+zz); 
 			for(i=0;i<8;i++)
 			{   
 				newx=x+(((i+(zz*8)+(pos*cfont.x_size))*cos(radian))-((j)*sin(radian)));
@@ -1041,107 +1165,216 @@ void UTFT::rotateChar(byte c, int x, int y, int pos, int deg)
 	clrXY();
 }
 
-void UTFT::print(char *st, int x, int y, int deg)
+int UTFT::_align_x(int x, int stl)
 {
-	int stl, i;
-
-	stl = strlen(st);
-
 	if (orient==PORTRAIT)
 	{
 	if (x==RIGHT)
-		x=(disp_x_size+1)-(stl*cfont.x_size);
+		x=(int(disp_x_size)+1)-(stl*cfont.x_size);
 	if (x==CENTER)
-		x=((disp_x_size+1)-(stl*cfont.x_size))/2;
+		x=((int(disp_x_size)+1)-(stl*cfont.x_size))/2;
 	}
 	else
 	{
 	if (x==RIGHT)
-		x=(disp_y_size+1)-(stl*cfont.x_size);
+		x=(int(disp_y_size)+1)-(stl*cfont.x_size);
 	if (x==CENTER)
-		x=((disp_y_size+1)-(stl*cfont.x_size))/2;
+		x=((int(disp_y_size)+1)-(stl*cfont.x_size))/2;
 	}
-
-	for (i=0; i<stl; i++)
-		if (deg==0)
-			printChar(*st++, x + (i*(cfont.x_size)), y);
-		else
-			rotateChar(*st++, x, y, i, deg);
+	return x;
 }
 
-void UTFT::print(String st, int x, int y, int deg)
+// Reads one UTF-8 encoded character from a string in RAM or PROGMEM and
+// moves st past it. A byte that does not start a valid sequence is
+// returned as it is, so strings using 8bit codes keep working.
+word UTFT::_utf8_next(const char **st, boolean pgm)
 {
-	char buf[st.length()+1];
+	const char	*p = *st;
+	byte		b0, b1, b2, b3;
+
+	b0 = pgm ? pgm_read_byte(p) : byte(p[0]);
+	*st = p+1;
+	if (b0<0x80)
+		return b0;
+
+	b1 = pgm ? pgm_read_byte(p+1) : byte(p[1]);
+	if ((b1 & 0xC0)!=0x80)
+		return b0;
+	if ((b0 & 0xE0)==0xC0)
+	{
+		if (b0<0xC2)
+			return b0;
+		*st = p+2;
+		return (word(b0 & 0x1F)<<6) | (b1 & 0x3F);
+	}
+
+	b2 = pgm ? pgm_read_byte(p+2) : byte(p[2]);
+	if ((b2 & 0xC0)!=0x80)
+		return b0;
+	if ((b0 & 0xF0)==0xE0)
+	{
+		if ((b0==0xE0) and (b1<0xA0))
+			return b0;
+		*st = p+3;
+		return (word(b0 & 0x0F)<<12) | (word(b1 & 0x3F)<<6) | (b2 & 0x3F);
+	}
 
-	st.toCharArray(buf, st.length()+1);
-	print(buf, x, y, deg);
+	b3 = pgm ? pgm_read_byte(p+3) : byte(p[3]);
+	if (((b0 & 0xF8)==0xF0) and ((b3 & 0xC0)==0x80))
+	{
+		// Outside the range a font can hold
+		*st = p+4;
+		return 0xFFFD;
+	}
+	return b0;
 }
 
-void UTFT::printNumI(long num, int x, int y, int length, char filler)
+int UTFT::_utf8_len(const char *st, boolean pgm)
 {
-	char buf[25];
-	char st[27];
-	boolean neg=false;
-	int c=0, f=0;
-  
-	if (num==0)
+	int stl = 0;
+
+	while ((pgm ? pgm_read_byte(st) : byte(*st))!=0)
 	{
-		if (length!=0)
-		{
-			for (c=0; c<(length-1); c++)
-				st[c]=filler;
-			st[c]=48;
-			st[c+1]=0;
-		}
-		else
-		{
-			st[0]=48;
-			st[1]=0;
-		}
+		_utf8_next(&st, pgm);
+		stl++;
 	}
-	else
-	{
-		if (num<0)
-		{
-			neg=true;
-			num=-num;
-		}
-	  
-		while (num>0)
-		{
-			buf[c]=48+(num % 10);
-			c++;
-			num=(num-(num % 10))/10;
-		}
-		buf[c]=0;
-	  
-		if (neg)
-		{
-			st[0]=45;
-		}
-	  
-		if (length>(c+neg))
-		{
-			for (int i=0; i<(length-c-neg); i++)
-			{
-				st[i+neg]=filler;
-				f++;
-			}
-		}
+	return stl;
+}
 
-		for (int i=0; i<c; i++)
-		{
-			st[i+neg+f]=buf[c-i-1];
-		}
-		st[c+neg+f]=0;
+void UTFT::print(const char *st, int x, int y, int deg)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_PRINT);
+	int stl = _utf8_len(st, false);
+
+	_print_str(st, false, stl, _align_x(x, stl), y, deg);
+}
+
+void UTFT::print(const String &st, int x, int y, int deg)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_PRINT);
+	print(st.c_str(), x, y, deg);
+}
+
+#if defined(F)
+void UTFT::print(const __FlashStringHelper *st, int x, int y, int deg)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_PRINT);
+	PGM_P	p = reinterpret_cast<PGM_P>(st);
+	int		stl = _utf8_len(p, true);
+
+	_print_str(p, true, stl, _align_x(x, stl), y, deg);
+}
+#endif
+
+// Draws the first stl characters of st from x, which is already aligned
+void UTFT::_print_str(const char *st, boolean pgm, int stl, int x, int y, int deg)
+{
+	for (int i=0; i<stl; i++)
+		if (deg==0)
+			printChar(_utf8_next(&st, pgm), x + (i*(cfont.x_size)), y);
+		else
+			rotateChar(_utf8_next(&st, pgm), x, y, i, deg);
+}
+
+void UTFT::printScaled(const char *st, int x, int y, byte scale)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_PRINT);
+	int stl, i;
+
+	if (scale<1)
+		scale=1;
+	stl = _utf8_len(st, false);
+	x = _align_x(x, stl*scale);
+
+	for (i=0; i<stl; i++)
+		printCharScaled(_utf8_next(&st, false), x + (i*cfont.x_size*scale), y, scale);
+}
 
+#if defined(F)
+void UTFT::printScaled(const __FlashStringHelper *st, int x, int y, byte scale)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_PRINT);
+	PGM_P	p = reinterpret_cast<PGM_P>(st);
+	int		stl, i;
+
+	if (scale<1)
+		scale=1;
+	stl = _utf8_len(p, true);
+	x = _align_x(x, stl*scale);
+
+	for (i=0; i<stl; i++)
+		printCharScaled(_utf8_next(&p, true), x + (i*cfont.x_size*scale), y, scale);
+}
+#endif
+
+// Prints the digits straight from the number, most significant first, so
+// no text buffer is needed.
+void UTFT::_print_num(unsigned long num, boolean neg, int x, int y, int length, char filler)
+{
+	unsigned long	div = 1;
+	int				c = 1, f = 0, pos = 0;
+
+	while ((num/div)>=10)
+	{
+		div*=10;
+		c++;
 	}
+	if (length>(c+neg))
+		f = length-c-neg;
 
-	print(st,x,y);
+	x = _align_x(x, neg+f+c);
+
+	if (neg)
+		printChar('-', x + (pos++*cfont.x_size), y);
+	for (int i=0; i<f; i++)
+		printChar(byte(filler), x + (pos++*cfont.x_size), y);
+	while (div>0)
+	{
+		printChar(48+((num/div) % 10), x + (pos++*cfont.x_size), y);
+		div/=10;
+	}
+}
+
+void UTFT::printNumI(int num, int x, int y, int length, char filler)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_PRINTNUM);
+	printNumI(long(num), x, y, length, filler);
+}
+
+void UTFT::printNumI(unsigned int num, int x, int y, int length, char filler)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_PRINTNUM);
+	_print_num(num, false, x, y, length, filler);
+}
+
+void UTFT::printNumI(long num, int x, int y, int length, char filler)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_PRINTNUM);
+	if (num<0)
+		_print_num(0UL-(unsigned long)num, true, x, y, length, filler);
+	else
+		_print_num(num, false, x, y, length, filler);
+}
+
+void UTFT::printNumI(unsigned long num, int x, int y, int length, char filler)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_PRINTNUM);
+	_print_num(num, false, x, y, length, filler);
 }
 
 void UTFT::printNumF(double num, byte dec, int x, int y, char divider, int length, char filler)
 {
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_PRINTNUM);
 	char st[27];
 	boolean neg=false;
 
@@ -1182,13 +1415,169 @@ void UTFT::printNumF(double num, byte dec, int x, int y, char divider, int lengt
 	print(st,x,y);
 }
 
+// Prints num/(10^dec) with dec decimals, laid out the same way as
+// printNumF(), without going through floating point or a text buffer.
+void UTFT::_print_fixed(unsigned long num, boolean neg, byte dec, int x, int y, char divider, int length, char filler)
+{
+	unsigned long	scale = 1, ip, fp, div = 1;
+	int				c = 1, f = 0, pos = 0;
+
+	for (byte i=0; i<dec; i++)
+		scale*=10;
+	ip = num/scale;
+	fp = num % scale;
+
+	while ((ip/div)>=10)
+	{
+		div*=10;
+		c++;
+	}
+	c += neg;
+	if (dec>0)
+		c += dec+1;
+	if (length>c)
+		f = length-c;
+
+	x = _align_x(x, c+f);
+
+	if (neg and (filler!=' '))
+		printChar('-', x + (pos++*cfont.x_size), y);
+	for (int i=0; i<f; i++)
+		printChar(byte(filler), x + (pos++*cfont.x_size), y);
+	if (neg and (filler==' '))
+		printChar('-', x + (pos++*cfont.x_size), y);
+	while (div>0)
+	{
+		printChar(48+((ip/div) % 10), x + (pos++*cfont.x_size), y);
+		div/=10;
+	}
+	if (dec>0)
+	{
+		printChar(byte(divider), x + (pos++*cfont.x_size), y);
+		for (div=scale/10; div>0; div/=10)
+			printChar(48+((fp/div) % 10), x + (pos++*cfont.x_size), y);
+	}
+}
+
+void UTFT::printNumFixed(long num, byte dec, int x, int y, char divider, int length, char filler)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_PRINTNUM);
+	if (dec>9)
+		dec=9;
+
+	if (num<0)
+		_print_fixed(0UL-(unsigned long)num, true, dec, x, y, divider, length, filler);
+	else
+		_print_fixed(num, false, dec, x, y, divider, length, filler);
+}
+
 void UTFT::setFont(uint8_t* font)
 {
 	cfont.font=font;
+	cfont.data=(assetptr)(uintptr_t)font;
+	_load_font();
+}
+
+// Sets a font by its flash address, e.g. setFont(ASSET_ADDRESS(BigFont)),
+// so it can be placed above the first 64Kb of flash. getFont() returns
+// NULL for such a font, use getFontAddress() instead.
+void UTFT::setFont(assetptr font)
+{
+#if defined(ASSET_FAR)
+	if (font>0xFFFF)
+		cfont.font=NULL;
+	else
+#endif
+		cfont.font=(uint8_t*)(uintptr_t)font;
+	cfont.data=font;
+	_load_font();
+}
+
+void UTFT::_load_font()
+{
+	cfont.lowflash=false;
 	cfont.x_size=fontbyte(0);
 	cfont.y_size=fontbyte(1);
 	cfont.offset=fontbyte(2);
 	cfont.numchars=fontbyte(3);
+	if ((cfont.offset==0) and (cfont.numchars==0))
+		cfont.numranges=fontbyte(FONT_SPARSE_RANGES);
+	else
+		cfont.numranges=0;
+#if defined(ASSET_FAR)
+	// Sparse fonts end after the glyph with the highest index
+	word	bytes = (cfont.x_size/8)*cfont.y_size;
+	word	glyphs = cfont.numchars;
+	word	pos, n;
+	long	size;
+
+	for (byte r=0; r<cfont.numranges; r++)
+	{
+		pos = FONT_SPARSE_TABLE+(r*FONT_SPARSE_RANGE_SIZE);
+		n = (fontbyte(pos+2) | (fontbyte(pos+3)<<8))+(fontbyte(pos+4) | (fontbyte(pos+5)<<8));
+		if (n>glyphs)
+			glyphs = n;
+	}
+	if (cfont.numranges==0)
+		size = 4+(long(glyphs)*bytes);
+	else
+		size = FONT_SPARSE_TABLE+(cfont.numranges*FONT_SPARSE_RANGE_SIZE)+(long(glyphs)*bytes);
+	cfont.lowflash = (cfont.data+size<=0x10000);
+#endif
+}
+
+// Returns the offset of the glyph for code point c in the current font,
+// or 0 if the font does not have it. The first range of a sparse font is
+// checked directly, as that is normally where ASCII is, before a binary
+// search of the remaining ranges.
+word UTFT::_glyph_offset(word c)
+{
+	word	bytes = (cfont.x_size/8)*cfont.y_size;
+	word	first, count, idx;
+	int		lo, hi, mid, r;
+
+	if (cfont.numranges==0)
+	{
+		if ((c<cfont.offset) or (c>=word(cfont.offset+cfont.numchars)))
+			return 0;
+		return ((c-cfont.offset)*bytes)+4;
+	}
+
+	r = -1;
+	first = fontbyte(FONT_SPARSE_TABLE) | (fontbyte(FONT_SPARSE_TABLE+1)<<8);
+	if (c<first)
+		return 0;
+	count = fontbyte(FONT_SPARSE_TABLE+2) | (fontbyte(FONT_SPARSE_TABLE+3)<<8);
+	if ((c-first)<count)
+		r = 0;
+	else
+	{
+		lo = 1;
+		hi = cfont.numranges-1;
+		while (lo<=hi)
+		{
+			mid = (lo+hi)/2;
+			first = fontbyte(FONT_SPARSE_TABLE+(mid*FONT_SPARSE_RANGE_SIZE)) | (fontbyte(FONT_SPARSE_TABLE+(mid*FONT_SPARSE_RANGE_SIZE)+1)<<8);
+			if (c<first)
+				hi = mid-1;
+			else
+			{
+				count = fontbyte(FONT_SPARSE_TABLE+(mid*FONT_SPARSE_RANGE_SIZE)+2) | (fontbyte(FONT_SPARSE_TABLE+(mid*FONT_SPARSE_RANGE_SIZE)+3)<<8);
+				if ((c-first)<count)
+				{
+					r = mid;
+					break;
+				}
+				lo = mid+1;
+			}
+		}
+		if (r<0)
+			return 0;
+	}
+
+	idx = fontbyte(FONT_SPARSE_TABLE+(r*FONT_SPARSE_RANGE_SIZE)+4) | (fontbyte(FONT_SPARSE_TABLE+(r*FONT_SPARSE_RANGE_SIZE)+5)<<8);
+	return FONT_SPARSE_TABLE+(cfont.numranges*FONT_SPARSE_RANGE_SIZE)+((idx+(c-first))*bytes);
 }
 
 uint8_t* UTFT::getFont()
@@ -1196,6 +1585,11 @@ uint8_t* UTFT::getFont()
 	return cfont.font;
 }
 
+assetptr UTFT::getFontAddress()
+{
+	return cfont.data;
+}
+
 uint8_t UTFT::getFontXsize()
 {
 	return cfont.x_size;
@@ -1206,104 +1600,646 @@ uint8_t UTFT::getFontYsize()
 	return cfont.y_size;
 }
 
+// Scales above 1 go through drawBitmapScaled(), whose 8.8 fixed point
+// factors stop at 255. Scales below 1 draw nothing.
 void UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int scale)
 {
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_DRAWBITMAP);
 	unsigned int col;
-	int tx, ty, tc, tsx, tsy;
+	int tx, ty, tc;
 
-	if (scale==1)
+	if (scale<1)
+		return;
+	if (scale!=1)
 	{
-		if (orient==PORTRAIT)
+		if (scale>255)
+			scale = 255;
+		drawBitmapScaled(x, y, sx, sy, data, word(scale)<<8, word(scale)<<8);
+		return;
+	}
+
+	if (orient==PORTRAIT)
+	{
+		cbi(P_CS, B_CS);
+		setXY(x, y, x+sx-1, y+sy-1);
+		for (tc=0; tc<(sx*sy); tc++)
 		{
-			cbi(P_CS, B_CS);
-			setXY(x, y, x+sx-1, y+sy-1);
-			for (tc=0; tc<(sx*sy); tc++)
+			col=pgm_read_word(&data[tc]);
+			LCD_PIXEL(col>>8,col & 0xff);
+		}
+		sbi(P_CS, B_CS);
+	}
+	else
+	{
+		cbi(P_CS, B_CS);
+		for (ty=0; ty<sy; ty++)
+		{
+			setXY(x, y+ty, x+sx-1, y+ty);
+			for (tx=sx-1; tx>=0; tx--)
 			{
-				col=pgm_read_word(&data[tc]);
-				LCD_Write_DATA(col>>8,col & 0xff);
+				col=pgm_read_word(&data[(ty*sx)+tx]);
+				LCD_PIXEL(col>>8,col & 0xff);
 			}
-			sbi(P_CS, B_CS);
 		}
-		else
+		sbi(P_CS, B_CS);
+	}
+	clrXY();
+}
+
+// Draws a bitmap given by its flash address, e.g. ASSET_ADDRESS(splash),
+// so it can be placed above the first 64Kb of flash. It is copied in
+// chunks of ASSET_CHUNK pixels, which needs the far address set up once
+// per chunk instead of once per pixel.
+void UTFT::drawBitmap(int x, int y, int sx, int sy, assetptr data)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_DRAWBITMAP);
+	word	buf[ASSET_CHUNK];
+	long	pos, total;
+	int		tx, ty, n, i;
+
+	cbi(P_CS, B_CS);
+	if (orient==PORTRAIT)
+	{
+		setXY(x, y, x+sx-1, y+sy-1);
+		total = long(sx)*sy;
+		for (pos=0; pos<total; pos+=n)
 		{
-			cbi(P_CS, B_CS);
-			for (ty=0; ty<sy; ty++)
+			n = ((total-pos)<ASSET_CHUNK) ? total-pos : ASSET_CHUNK;
+			asset_read(buf, data+(pos*2), n*2);
+			for (i=0; i<n; i++)
+				LCD_PIXEL(buf[i]>>8,buf[i] & 0xff);
+		}
+	}
+	else
+	{
+		for (ty=0; ty<sy; ty++)
+		{
+			setXY(x, y+ty, x+sx-1, y+ty);
+			for (tx=sx; tx>0; tx-=n)
 			{
-				setXY(x, y+ty, x+sx-1, y+ty);
-				for (tx=sx-1; tx>=0; tx--)
-				{
-					col=pgm_read_word(&data[(ty*sx)+tx]);
-					LCD_Write_DATA(col>>8,col & 0xff);
-				}
+				n = (tx<ASSET_CHUNK) ? tx : ASSET_CHUNK;
+				asset_read(buf, data+(((long(ty)*sx)+tx-n)*2), n*2);
+				for (i=n-1; i>=0; i--)
+					LCD_PIXEL(buf[i]>>8,buf[i] & 0xff);
 			}
-			sbi(P_CS, B_CS);
+		}
+	}
+	sbi(P_CS, B_CS);
+	clrXY();
+}
+
+// Sends n pixels from RAM into the current window, backwards if reverse
+// is set, four at a time.
+void UTFT::_write_run(const word *buf, int n, boolean reverse)
+{
+	word	c0, c1, c2, c3;
+
+	if (reverse)
+	{
+		buf += n;
+		for (; n>=4; n-=4)
+		{
+			buf -= 4;
+			c0 = buf[3]; c1 = buf[2]; c2 = buf[1]; c3 = buf[0];
+			LCD_PIXEL(c0>>8, c0 & 0xFF);
+			LCD_PIXEL(c1>>8, c1 & 0xFF);
+			LCD_PIXEL(c2>>8, c2 & 0xFF);
+			LCD_PIXEL(c3>>8, c3 & 0xFF);
+		}
+		while (n-->0)
+		{
+			c0 = *--buf;
+			LCD_PIXEL(c0>>8, c0 & 0xFF);
 		}
 	}
 	else
 	{
-		if (orient==PORTRAIT)
+		for (; n>=4; n-=4)
 		{
-			cbi(P_CS, B_CS);
-			for (ty=0; ty<sy; ty++)
+			c0 = buf[0]; c1 = buf[1]; c2 = buf[2]; c3 = buf[3];
+			buf += 4;
+			LCD_PIXEL(c0>>8, c0 & 0xFF);
+			LCD_PIXEL(c1>>8, c1 & 0xFF);
+			LCD_PIXEL(c2>>8, c2 & 0xFF);
+			LCD_PIXEL(c3>>8, c3 & 0xFF);
+		}
+		while (n-->0)
+		{
+			c0 = *buf++;
+			LCD_PIXEL(c0>>8, c0 & 0xFF);
+		}
+	}
+}
+
+// Sends n pixels of a bitmap in flash into the current window, backwards
+// if reverse is set. For add-on libraries that draw parts of bitmaps.
+void UTFT::_write_bitmap_run(bitmapdatatype data, int n, boolean reverse)
+{
+	word	col;
+
+	if (reverse)
+	{
+		data += n;
+		while (n-->0)
+		{
+			col = pgm_read_word(--data);
+			LCD_PIXEL(col>>8, col & 0xFF);
+		}
+	}
+	else
+	{
+		while (n-->0)
+		{
+			col = pgm_read_word(data++);
+			LCD_PIXEL(col>>8, col & 0xFF);
+		}
+	}
+}
+
+// Draws w x h RGB565 pixels from a buffer in RAM, row by row, through a
+// single window. Unlike drawBitmap() the data is not read from flash.
+void UTFT::writePixels(int x, int y, int w, int h, const word *buf)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_WRITEPIXELS);
+	int		ty;
+
+	if ((w<=0) or (h<=0))
+		return;
+
+	cbi(P_CS, B_CS);
+	if (orient==PORTRAIT)
+	{
+		setXY(x, y, x+w-1, y+h-1);
+		for (ty=0; ty<h; ty++)
+			_write_run(&buf[long(ty)*w], w, false);
+	}
+	else
+	{
+		for (ty=0; ty<h; ty++)
+		{
+			setXY(x, y+ty, x+w-1, y+ty);
+			_write_run(&buf[long(ty)*w], w, true);
+		}
+	}
+	sbi(P_CS, B_CS);
+	clrXY();
+}
+
+// Draws w x h pixels made by gen(), which fills buf with the n pixels
+// starting at column col of row row of the area, left to right. n is at
+// most PIXEL_CHUNK, so only that much RAM is needed however big the area.
+void UTFT::writePixels(int x, int y, int w, int h, void (*gen)(int col, int row, int n, word *buf))
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_WRITEPIXELS);
+	word	buf[PIXEL_CHUNK];
+	int		tx, ty, n;
+
+	if ((w<=0) or (h<=0))
+		return;
+
+	cbi(P_CS, B_CS);
+	if (orient==PORTRAIT)
+	{
+		setXY(x, y, x+w-1, y+h-1);
+		for (ty=0; ty<h; ty++)
+			for (tx=0; tx<w; tx+=n)
 			{
-				setXY(x, y+(ty*scale), x+((sx*scale)-1), y+(ty*scale)+scale);
-				for (tsy=0; tsy<scale; tsy++)
-					for (tx=0; tx<sx; tx++)
-					{
-						col=pgm_read_word(&data[(ty*sx)+tx]);
-						for (tsx=0; tsx<scale; tsx++)
-							LCD_Write_DATA(col>>8,col & 0xff);
-					}
+				n = ((w-tx)<PIXEL_CHUNK) ? w-tx : PIXEL_CHUNK;
+				gen(tx, ty, n, buf);
+				_write_run(buf, n, false);
+			}
+	}
+	else
+	{
+		for (ty=0; ty<h; ty++)
+		{
+			setXY(x, y+ty, x+w-1, y+ty);
+			for (tx=w; tx>0; tx-=n)
+			{
+				n = (tx<PIXEL_CHUNK) ? tx : PIXEL_CHUNK;
+				gen(tx-n, ty, n, buf);
+				_write_run(buf, n, true);
 			}
-			sbi(P_CS, B_CS);
+		}
+	}
+	sbi(P_CS, B_CS);
+	clrXY();
+}
+
+// Nearest-neighbour scaling by 8.8 fixed point factors, independently in
+// each direction. Destination pixel i is taken from source pixel
+// ((2i+1)*sx)/(2*dw), stepped with an integer DDA so there is no rounding
+// drift. Every source pixel is read once per destination row, and equal
+// neighbouring pixels are sent as one fast fill.
+void UTFT::drawBitmapScaled(int x, int y, int sx, int sy, bitmapdatatype data, word scalex, word scaley)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_DRAWBITMAP);
+	int		dw = (long(sx)*scalex)>>8;
+	int		dh = (long(sy)*scaley)>>8;
+	int		srow, scol, tx, ty, n;
+	long	rrem, crem;
+	unsigned int col, next;
+	bitmapdatatype row;
+	boolean	reverse;
+
+	if ((dw<=0) or (dh<=0))
+		return;
+
+	reverse = (orient==LANDSCAPE);
+
+	cbi(P_CS, B_CS);
+	if (orient==PORTRAIT)
+		setXY(x, y, x+dw-1, y+dh-1);
+
+	srow = long(sy)/(2*dh);
+	rrem = long(sy)%(2*dh);
+	for (ty=0; ty<dh; ty++)
+	{
+		if (orient!=PORTRAIT)
+			setXY(x, y+ty, x+dw-1, y+ty);
+		row = &data[long(srow)*sx];
+
+		// Columns are walked right to left when a LANDSCAPE row is sent
+		if (reverse)
+		{
+			scol = (long(2*dw-1)*sx)/(2*dw);
+			crem = (long(2*dw-1)*sx)%(2*dw);
 		}
 		else
 		{
-			cbi(P_CS, B_CS);
-			for (ty=0; ty<sy; ty++)
+			scol = long(sx)/(2*dw);
+			crem = long(sx)%(2*dw);
+		}
+		col = pgm_read_word(&row[scol]);
+		n = 0;
+		for (tx=0; tx<dw; tx++)
+		{
+			n++;
+			if (tx==dw-1)
+				break;
+			if (reverse)
 			{
-				for (tsy=0; tsy<scale; tsy++)
+				crem -= 2*sx;
+				if (crem<0)
 				{
-					setXY(x, y+(ty*scale)+tsy, x+((sx*scale)-1), y+(ty*scale)+tsy);
-					for (tx=sx-1; tx>=0; tx--)
+					do
 					{
-						col=pgm_read_word(&data[(ty*sx)+tx]);
-						for (tsx=0; tsx<scale; tsx++)
-							LCD_Write_DATA(col>>8,col & 0xff);
+						crem += 2*dw;
+						scol--;
+					} while (crem<0);
+					next = pgm_read_word(&row[scol]);
+					if (next!=col)
+					{
+						_fast_fill_run(col>>8, col & 0xFF, n);
+						col = next;
+						n = 0;
 					}
 				}
 			}
-			sbi(P_CS, B_CS);
+			else
+			{
+				crem += 2*sx;
+				if (crem>=2*dw)
+				{
+					do
+					{
+						crem -= 2*dw;
+						scol++;
+					} while (crem>=2*dw);
+					next = pgm_read_word(&row[scol]);
+					if (next!=col)
+					{
+						_fast_fill_run(col>>8, col & 0xFF, n);
+						col = next;
+						n = 0;
+					}
+				}
+			}
+		}
+		_fast_fill_run(col>>8, col & 0xFF, n);
+
+		rrem += 2*sy;
+		while (rrem>=2*dh)
+		{
+			rrem -= 2*dh;
+			srow++;
 		}
 	}
+	sbi(P_CS, B_CS);
 	clrXY();
 }
 
-void UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int deg, int rox, int roy)
+// Rotates a bitmap around (rox, roy) by walking the rows of the rotated
+// bounding box and mapping each destination pixel back into the source
+// with 16.16 fixed point steps, so there are no holes. Each row is sent
+// through one window. Pixels outside the source are left alone, or are
+// filled with bgcolor when it is not VGA_TRANSPARENT.
+void UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int deg, int rox, int roy, uint32_t bgcolor)
 {
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_DRAWBITMAP);
 	unsigned int col;
-	int tx, ty, newx, newy;
-	double radian;
+	long	c, s, u, v, u0, v0, t;
+	long	bx1, by1, bx2, by2;
+	int		x1, y1, x2, y2, tx, ty, first, last, dx2, dy2;
+	int		cpx[4] = {-rox, sx-rox, -rox, sx-rox};
+	int		cpy[4] = {-roy, -roy, sy-roy, sy-roy};
+	boolean	reverse, fill;
+	double	radian;
 	radian=deg*0.0175;  
 
 	if (deg==0)
+	{
 		drawBitmap(x, y, sx, sy, data);
-	else
+		return;
+	}
+
+	c = cos(radian)*65536;
+	s = sin(radian)*65536;
+
+	bx1 = bx2 = (long(x+rox)<<16)+(cpx[0]*c)-(cpy[0]*s);
+	by1 = by2 = (long(y+roy)<<16)+(cpy[0]*c)+(cpx[0]*s);
+	for (int i=1; i<4; i++)
 	{
-		cbi(P_CS, B_CS);
-		for (ty=0; ty<sy; ty++)
-			for (tx=0; tx<sx; tx++)
+		t = (long(x+rox)<<16)+(cpx[i]*c)-(cpy[i]*s);
+		if (t<bx1) bx1 = t;
+		if (t>bx2) bx2 = t;
+		t = (long(y+roy)<<16)+(cpy[i]*c)+(cpx[i]*s);
+		if (t<by1) by1 = t;
+		if (t>by2) by2 = t;
+	}
+	x1 = (bx1<0) ? 0 : bx1>>16;
+	y1 = (by1<0) ? 0 : by1>>16;
+	bx2 = (bx2+0xFFFF)>>16;
+	by2 = (by2+0xFFFF)>>16;
+	x2 = ((bx2>getDisplayXSize()) ? getDisplayXSize() : bx2)-1;
+	y2 = ((by2>getDisplayYSize()) ? getDisplayYSize() : by2)-1;
+
+	fill = (bgcolor!=VGA_TRANSPARENT);
+	reverse = (orient==LANDSCAPE);
+
+	cbi(P_CS, B_CS);
+	for (ty=y1; ty<=y2; ty++)
+	{
+		// Source position of the centre of (x1, ty), counted in half pixels
+		// from the rotation point to keep the products inside 32 bits
+		dx2 = 2*(x1-(x+rox))+1;
+		dy2 = 2*(ty-(y+roy))+1;
+		u0 = ((dx2*c)+(dy2*s))/2+(long(rox)<<16);
+		v0 = ((dy2*c)-(dx2*s))/2+(long(roy)<<16);
+
+		first = -1;
+		last = -1;
+		u = u0;
+		v = v0;
+		for (tx=x1; tx<=x2; tx++)
+		{
+			if ((u>=0) and (v>=0) and ((u>>16)<sx) and ((v>>16)<sy))
 			{
-				col=pgm_read_word(&data[(ty*sx)+tx]);
+				if (first<0)
+					first = tx;
+				last = tx;
+			}
+			u += c;
+			v -= s;
+		}
+		if (fill)
+		{
+			first = x1;
+			last = x2;
+		}
+		else if (first<0)
+			continue;
+
+		setXY(first, ty, last, ty);
+		if (reverse)
+		{
+			u = u0+((last-x1)*c);
+			v = v0-((last-x1)*s);
+		}
+		else
+		{
+			u = u0+((first-x1)*c);
+			v = v0-((first-x1)*s);
+		}
+		for (tx=first; tx<=last; tx++)
+		{
+			if ((u>=0) and (v>=0) and ((u>>16)<sx) and ((v>>16)<sy))
+			{
+				col=pgm_read_word(&data[((v>>16)*sx)+(u>>16)]);
+				LCD_PIXEL(col>>8,col & 0xff);
+			}
+			else
+				LCD_PIXEL(byte(bgcolor>>8),byte(bgcolor & 0xFF));
+			if (reverse)
+			{
+				u -= c;
+				v += s;
+			}
+			else
+			{
+				u += c;
+				v -= s;
+			}
+		}
+	}
+	sbi(P_CS, B_CS);
+	clrXY();
+}
+
+void UTFT::drawAtlasRegion(int x, int y, bitmapdatatype atlas, bitmapdatatype regions, int id)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_DRAWBITMAP);
+	bitmapdatatype r;
+
+	if ((id<0) or (id>=pgm_read_word(&regions[1])))
+		return;
+	r = &regions[ATLAS_HEADER_SIZE+(id*ATLAS_REGION_SIZE)];
+	drawAtlasRegion(x, y, atlas, pgm_read_word(&regions[0]), pgm_read_word(&r[0]), pgm_read_word(&r[1]), pgm_read_word(&r[2]), pgm_read_word(&r[3]));
+}
 
-				newx=x+rox+(((tx-rox)*cos(radian))-((ty-roy)*sin(radian)));
-				newy=y+roy+(((ty-roy)*cos(radian))+((tx-rox)*sin(radian)));
+// Draws the rw x rh rectangle at (rx, ry) of a bitmap that is aw pixels
+// wide, reading it straight from flash.
+void UTFT::drawAtlasRegion(int x, int y, bitmapdatatype atlas, int aw, int rx, int ry, int rw, int rh)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_DRAWBITMAP);
+	unsigned int col;
+	int tx, ty;
+	bitmapdatatype row;
 
-				setXY(newx, newy, newx, newy);
-				LCD_Write_DATA(col>>8,col & 0xff);
+	cbi(P_CS, B_CS);
+	if (orient==PORTRAIT)
+		setXY(x, y, x+rw-1, y+rh-1);
+	for (ty=0; ty<rh; ty++)
+	{
+		row = &atlas[(long(ry+ty)*aw)+rx];
+		if (orient==PORTRAIT)
+			for (tx=0; tx<rw; tx++)
+			{
+				col=pgm_read_word(&row[tx]);
+				LCD_PIXEL(col>>8,col & 0xff);
 			}
-		sbi(P_CS, B_CS);
+		else
+		{
+			setXY(x, y+ty, x+rw-1, y+ty);
+			for (tx=rw-1; tx>=0; tx--)
+			{
+				col=pgm_read_word(&row[tx]);
+				LCD_PIXEL(col>>8,col & 0xff);
+			}
+		}
+	}
+	sbi(P_CS, B_CS);
+	clrXY();
+}
+
+// Pixel i of a run of stored pixels: a RGB565 word when bpp is 16,
+// otherwise a palette index packed MSB first.
+word UTFT::_bitmap_pixel(const uint8_t *src, byte bpp, const uint8_t *pal, long i)
+{
+	byte idx;
+
+	if (bpp==16)
+		return pgm_read_word(&src[i*2]);
+	if (bpp==8)
+		idx=pgm_read_byte(&src[i]);
+	else
+	{
+		i*=bpp;
+		idx=(pgm_read_byte(&src[i>>3])>>(8-bpp-(i & 7))) & ((1<<bpp)-1);
+	}
+	return pgm_read_word(&pal[idx*2]);
+}
+
+// Draws a bitmap in one of the BITMAP_* formats, decoding it while it is
+// sent. In PORTRAIT, or LANDSCAPE on a controller that can stream it, the
+// whole bitmap goes through one window. Equal neighbouring pixels are sent
+// with a single fast fill. Bitmaps with an unknown format or number of
+// bits per pixel are not drawn.
+void UTFT::drawCompressedBitmap(int x, int y, const uint8_t *data)
+{
+	RETURN_IF_NOT_READY;
+	UTFT_PROFILE_SCOPE(this, PROFILE_DRAWBITMAP);
+	byte	fmt = pgm_read_byte(&data[0]);
+	byte	bpp = pgm_read_byte(&data[1]);
+	int		sx = pgm_read_word(&data[2]);
+	int		sy = pgm_read_word(&data[4]);
+	const uint8_t *pal = NULL;
+	const uint8_t *src = &data[BITMAP_HEADER_SIZE];
+	int		tx, ty, n, seg, i;
+	word	col = 0, next;
+	byte	ctl;
+
+	// Anything else can't be decoded, and could read far past the data
+	switch (fmt)
+	{
+	case BITMAP_RLE:
+		if (bpp!=16)
+			return;
+		break;
+	case BITMAP_PALETTE:
+		if ((bpp!=1) and (bpp!=2) and (bpp!=4) and (bpp!=8))
+			return;
+		break;
+	case BITMAP_PALETTE_RLE:
+		if (bpp!=8)
+			return;
+		break;
+	default:
+		return;
+	}
+
+	if (fmt!=BITMAP_RLE)
+	{
+		pal = src+1;
+		src = pal+((pgm_read_byte(src)+1)*2);
+	}
+
+	cbi(P_CS, B_CS);
+	if (orient==PORTRAIT)
+		setXY(x, y, x+sx-1, y+sy-1);
+
+	if (fmt==BITMAP_PALETTE)
+	{
+		for (ty=0; ty<sy; ty++)
+		{
+			if (orient!=PORTRAIT)
+				setXY(x, y+ty, x+sx-1, y+ty);
+			tx = 0;
+			while (tx<sx)
+			{
+				if (orient==PORTRAIT)
+					col = _bitmap_pixel(src, bpp, pal, (long(ty)*sx)+tx);
+				else
+					col = _bitmap_pixel(src, bpp, pal, (long(ty)*sx)+sx-1-tx);
+				n = 1;
+				while ((tx+n)<sx)
+				{
+					if (orient==PORTRAIT)
+						next = _bitmap_pixel(src, bpp, pal, (long(ty)*sx)+tx+n);
+					else
+						next = _bitmap_pixel(src, bpp, pal, (long(ty)*sx)+sx-1-tx-n);
+					if (next!=col)
+						break;
+					n++;
+				}
+				_fast_fill_run(col>>8, col & 0xFF, n);
+				tx += n;
+			}
+		}
+	}
+	else
+	{
+		// Packets may run on into the next row. Without a single window
+		// they are split at row ends and each piece gets its own window.
+		tx = 0;
+		ty = 0;
+		while (ty<sy)
+		{
+			ctl = pgm_read_byte(src++);
+			n = (ctl & 0x7F)+1;
+			if (ctl & BITMAP_RLE_RUN)
+			{
+				col = _bitmap_pixel(src, bpp, pal, 0);
+				src += bpp/8;
+			}
+			while ((n>0) and (ty<sy))
+			{
+				seg = (n<(sx-tx)) ? n : sx-tx;
+				if (orient!=PORTRAIT)
+					setXY(x+tx, y+ty, x+tx+seg-1, y+ty);
+				if (ctl & BITMAP_RLE_RUN)
+					_fast_fill_run(col>>8, col & 0xFF, seg);
+				else
+				{
+					for (i=0; i<seg; i++)
+					{
+						if (orient==PORTRAIT)
+							col = _bitmap_pixel(src, bpp, pal, i);
+						else
+							col = _bitmap_pixel(src, bpp, pal, seg-1-i);
+						LCD_PIXEL(col>>8, col & 0xFF);
+					}
+					src += seg*(bpp/8);
+				}
+				n -= seg;
+				tx += seg;
+				if (tx==sx)
+				{
+					tx = 0;
+					ty++;
+				}
+			}
+		}
 	}
+	sbi(P_CS, B_CS);
 	clrXY();
 }
 
@@ -1410,3 +2346,79 @@ void UTFT::setWritePage(byte page)
 	}
 	sbi(P_CS, B_CS);
 }
+
+#if defined(UTFT_PROFILE)
+static const char _profile_names[PROFILE_SLOTS][12] PROGMEM = {
+	"other", "InitLCD", "clrScr", "fillScr", "drawPixel", "drawLine",
+	"drawRect", "fillRect", "drawCircle", "fillCircle", "print", "printNum",
+	"drawBitmap", "writePixels", "GlyphCache", "NumField", "Sprites"};
+
+void UTFT::resetProfile()
+{
+	memset(profile, 0, sizeof(profile));
+	_profile_id = PROFILE_OTHER;
+}
+
+utft_profile_type UTFT::getProfile(byte id)
+{
+	utft_profile_type	p;
+
+	if (id<PROFILE_SLOTS)
+		return profile[id];
+	memset(&p, 0, sizeof(p));
+	return p;
+}
+
+utft_profile_type UTFT::getProfileTotal()
+{
+	utft_profile_type	p;
+
+	memset(&p, 0, sizeof(p));
+	for (byte i=0; i<PROFILE_SLOTS; i++)
+	{
+		p.calls += profile[i].calls;
+		p.com   += profile[i].com;
+		p.data  += profile[i].data;
+		p.wr    += profile[i].wr;
+		p.setxy += profile[i].setxy;
+	}
+	return p;
+}
+
+// The name is in PROGMEM
+const char *UTFT::getProfileName(byte id)
+{
+	if (id<PROFILE_SLOTS)
+		return _profile_names[id];
+	return _profile_names[PROFILE_OTHER];
+}
+
+#if defined(ARDUINO)
+static void _print_profile_line(Print &out, const __FlashStringHelper *name, utft_profile_type *p)
+{
+	out.print(name);
+	out.print('\t');
+	out.print(p->calls);
+	out.print('\t');
+	out.print(p->com);
+	out.print('\t');
+	out.print(p->data);
+	out.print('\t');
+	out.print(p->wr);
+	out.print('\t');
+	out.println(p->setxy);
+}
+
+// Prints one line for every function that sent something, then the total
+void UTFT::printProfile(Print &out)
+{
+	utft_profile_type	total = getProfileTotal();
+
+	out.println(F("function\tcalls\tcom\tdata\twr\tsetXY"));
+	for (byte i=0; i<PROFILE_SLOTS; i++)
+		if ((profile[i].calls!=0) or (profile[i].com!=0) or (profile[i].data!=0) or (profile[i].wr!=0))
+			_print_profile_line(out, (const __FlashStringHelper *)_profile_names[i], &profile[i]);
+	_print_profile_line(out, F("total"), &total);
+}
+#endif
+#endif
@@ -53,6 +53,8 @@
 
 #define PORTRAIT 0
 #define LANDSCAPE 1
+#define PORTRAIT_FLIPPED 2		// Rotated 180 degrees, on controllers that
+#define LANDSCAPE_FLIPPED 3		// rotate in hardware, see utft_driver_type
 
 #define HX8347A			0
 #define ILI9327			1
@@ -194,21 +196,213 @@
 	#include "hardware/arm/HW_ARM_defines.h"
 #endif
 
+// Fonts start with a 4 byte header: x_size, y_size, offset, numchars.
+// A header with offset and numchars both 0 marks a sparse font. It is
+// followed by the number of code point ranges and then, for each range
+// sorted by code point, 16bit little-endian first code point, number of
+// characters and index of its first glyph. The glyphs follow the table.
+#define FONT_SPARSE_RANGES		4	// Offset of the range count in a sparse font
+#define FONT_SPARSE_TABLE		5	// Offset of the first range
+#define FONT_SPARSE_RANGE_SIZE	6
+
+// Compressed bitmaps start with a 6 byte header: format, bits per pixel
+// and 16bit little-endian width and height. The palette formats follow it
+// with the number of colors minus one and the RGB565 palette. Pixels are
+// stored row by row with no padding at the end of a row.
+#define BITMAP_RLE				1	// Run-length packets of RGB565 pixels
+#define BITMAP_PALETTE			2	// Packed 1, 2, 4 or 8 bit palette indices, MSB first
+#define BITMAP_PALETTE_RLE		3	// Run-length packets of 8 bit palette indices
+#define BITMAP_HEADER_SIZE		6
+// A run-length packet starts with a control byte n. With BITMAP_RLE_RUN set
+// the next pixel is repeated (n & 0x7F)+1 times, otherwise n+1 pixels follow.
+#define BITMAP_RLE_RUN			0x80
+// An atlas is one RGB565 bitmap holding many images. Its region table
+// holds the atlas width and the number of regions, then x, y, width and
+// height of each region, all as 16bit words.
+#define ATLAS_HEADER_SIZE		2
+#define ATLAS_REGION_SIZE		4
+// Scale factors for drawBitmapScaled() are 8.8 fixed point, 256 is 1:1
+#define BITMAP_SCALE(f)			((word)((f)*256))
+// Controller init tables start with the reset timing: RESX low time in
+// microseconds and the wait after it in milliseconds. Each command that
+// follows is given with its number of parameters, ORed with INIT_DELAY if
+// a wait in milliseconds comes after the parameters.
+#define INIT_HEADER_SIZE		2
+#define INIT_DELAY				0x80
+#define INIT_STOP				0xFF	// In place of the number of parameters
+#define INIT_END				0x00, INIT_STOP
+
+// Only setFont() and drawBitmap() take an assetptr. drawBitmapScaled(),
+// drawAtlasRegion(), drawCompressedBitmap() and UTFT_Sprites read their
+// data through 16bit pointers, so on an ATmega2560 it has to be in the
+// first 64Kb of flash, where the linker puts PROGMEM data first.
+#define ASSET_CHUNK				32	// Pixels read from flash at a time by drawBitmap(assetptr)
+#define PIXEL_CHUNK				32	// Pixels asked from a writePixels() generator at a time
+
+// Building with -DUTFT_PROFILE counts what is sent to the display against
+// the public function that sent it. Without it the counting compiles out.
+#define PROFILE_OTHER			0	// Sent outside the functions below
+#define PROFILE_INITLCD			1
+#define PROFILE_CLRSCR			2
+#define PROFILE_FILLSCR			3
+#define PROFILE_DRAWPIXEL		4
+#define PROFILE_DRAWLINE		5
+#define PROFILE_DRAWRECT		6	// drawRect() and drawRoundRect()
+#define PROFILE_FILLRECT		7	// fillRect() and fillRoundRect()
+#define PROFILE_DRAWCIRCLE		8
+#define PROFILE_FILLCIRCLE		9
+#define PROFILE_PRINT			10	// print() and printScaled()
+#define PROFILE_PRINTNUM		11	// printNumI(), printNumF() and printNumFixed()
+#define PROFILE_DRAWBITMAP		12	// All the bitmap and atlas functions
+#define PROFILE_WRITEPIXELS		13
+#define PROFILE_GLYPHCACHE		14	// UTFT_GlyphCache::print()
+#define PROFILE_NUMFIELD		15	// UTFT_NumField::set()
+#define PROFILE_SPRITES			16	// UTFT_Sprites::update()
+#define PROFILE_SLOTS			17
+
+typedef struct
+{
+	unsigned long	calls;	// Outermost calls of the function
+	unsigned long	com;	// LCD_Write_COM()
+	unsigned long	data;	// LCD_Write_DATA(), one per pixel or register value
+	unsigned long	wr;		// WR pulses from _fast_fill_16() and _fast_fill_8()
+	unsigned long	setxy;	// setXY()
+} utft_profile_type;
+
+#if defined(UTFT_PROFILE)
+	#define UTFT_PROFILE_SCOPE(t, id)		UTFT_ProfileScope _profile_scope(t, id)
+	#define UTFT_PROFILE_ADD(t, counter, n)	((t)->profile[(t)->_profile_id].counter += (n))
+#else
+	#define UTFT_PROFILE_SCOPE(t, id)
+	#define UTFT_PROFILE_ADD(t, counter, n)
+#endif
+
 struct _current_font
 {
 	uint8_t* font;
+	assetptr data;
 	uint8_t x_size;
 	uint8_t y_size;
 	uint8_t offset;
 	uint8_t numchars;
+	uint8_t numranges;
+	boolean lowflash;	// All of the font is in the first 64Kb of flash
 };
 
+// Largest x and y in PORTRAIT and the bus of each model, as constants
+// for code that knows the model at compile time.
+template <byte model> struct utft_model_type;
+#define UTFT_MODEL_TYPE(model, xs, ys, tm) \
+	template <> struct utft_model_type<model> \
+	{ \
+		static const word	x_size = xs; \
+		static const word	y_size = ys; \
+		static const byte	transfer_mode = tm; \
+	}
+UTFT_MODEL_TYPE(HX8347A,			239, 319, 16);
+UTFT_MODEL_TYPE(ILI9327,			239, 399, 16);
+UTFT_MODEL_TYPE(SSD1289,			239, 319, 16);
+UTFT_MODEL_TYPE(SSD1289_8,			239, 319, 8);
+UTFT_MODEL_TYPE(SSD1289LATCHED,		239, 319, LATCHED_16);
+UTFT_MODEL_TYPE(ILI9325C,			239, 319, 8);
+UTFT_MODEL_TYPE(ILI9325D_8,			239, 319, 8);
+UTFT_MODEL_TYPE(ILI9325D_16,		239, 319, 16);
+UTFT_MODEL_TYPE(ILI9325D_16ALT,		239, 319, 16);
+UTFT_MODEL_TYPE(HX8340B_8,			175, 219, 8);
+UTFT_MODEL_TYPE(HX8340B_S,			175, 219, SERIAL_4PIN);
+UTFT_MODEL_TYPE(HX8352A,			239, 399, 16);
+UTFT_MODEL_TYPE(ST7735,				127, 159, SERIAL_5PIN);
+UTFT_MODEL_TYPE(ST7735_ALT,			127, 159, SERIAL_5PIN);
+UTFT_MODEL_TYPE(PCF8833,			127, 127, SERIAL_5PIN);
+UTFT_MODEL_TYPE(S1D19122,			239, 319, 16);
+UTFT_MODEL_TYPE(SSD1963_480,		271, 479, 16);
+UTFT_MODEL_TYPE(SSD1963_800,		479, 799, 16);
+UTFT_MODEL_TYPE(SSD1963_800ALT,		479, 799, 16);
+UTFT_MODEL_TYPE(S6D1121_8,			239, 319, 8);
+UTFT_MODEL_TYPE(S6D1121_16,			239, 319, 16);
+UTFT_MODEL_TYPE(ILI9481,			319, 479, 16);
+UTFT_MODEL_TYPE(S6D0164,			175, 219, 8);
+UTFT_MODEL_TYPE(ST7735S,			127, 159, SERIAL_5PIN);
+UTFT_MODEL_TYPE(ILI9341_S4P,		239, 319, SERIAL_4PIN);
+UTFT_MODEL_TYPE(ILI9341_S5P,		239, 319, SERIAL_5PIN);
+UTFT_MODEL_TYPE(R61581,				319, 479, 16);
+UTFT_MODEL_TYPE(ILI9486,			319, 479, 16);
+UTFT_MODEL_TYPE(ILI9486_8,			319, 479, 8);
+UTFT_MODEL_TYPE(CPLD,				799, 479, 16);
+UTFT_MODEL_TYPE(HX8353C,			127, 159, SERIAL_5PIN);
+UTFT_MODEL_TYPE(SPFD5420,			239, 399, 16);
+UTFT_MODEL_TYPE(HX8357B,			319, 479, 16);
+UTFT_MODEL_TYPE(HX8357C,			319, 479, 16);
+UTFT_MODEL_TYPE(ILI9488,			319, 479, 16);
+UTFT_MODEL_TYPE(ILI9488_8,			319, 479, 8);
+
+// Every model has a driver descriptor, see tft_drivers/drivers.h. The
+// constructor looks the model up inline, so when the model is a constant
+// only its own descriptor and driver functions are referenced and the
+// linker leaves out all the others. A model that is only known at run time
+// pulls in every driver that is not disabled in memorysaver.h.
+// The descriptors are in PROGMEM and only read through memcpy_P() and
+// pgm_read_*(), so the ones a run time model pulls in take no RAM.
+class UTFT;
+typedef struct
+{
+	word			x_size, y_size;		// Largest x and y in PORTRAIT
+	byte			transfer_mode;		// 8, 16, LATCHED_16, SERIAL_4PIN or SERIAL_5PIN
+	const uint8_t	*init_table;		// Sent by updateInitLCD(), or NULL to call init
+	void			(UTFT::*init)();
+	void			(UTFT::*setxy)(word x1, word y1, word x2, word y2);
+	const uint8_t	*madctl;			// Memory Access Control (0x36) for each orientation, or NULL
+} utft_driver_type;
+
+extern const utft_driver_type	utft_driver_HX8347A,
+								utft_driver_ILI9327,
+								utft_driver_SSD1289,
+								utft_driver_SSD1289_8,
+								utft_driver_SSD1289LATCHED,
+								utft_driver_ILI9325C,
+								utft_driver_ILI9325D_8,
+								utft_driver_ILI9325D_16,
+								utft_driver_ILI9325D_16ALT,
+								utft_driver_HX8340B_8,
+								utft_driver_HX8340B_S,
+								utft_driver_HX8352A,
+								utft_driver_ST7735,
+								utft_driver_ST7735_ALT,
+								utft_driver_PCF8833,
+								utft_driver_S1D19122,
+								utft_driver_SSD1963_480,
+								utft_driver_SSD1963_800,
+								utft_driver_SSD1963_800ALT,
+								utft_driver_S6D1121_8,
+								utft_driver_S6D1121_16,
+								utft_driver_ILI9481,
+								utft_driver_S6D0164,
+								utft_driver_ST7735S,
+								utft_driver_ILI9341_S4P,
+								utft_driver_ILI9341_S5P,
+								utft_driver_R61581,
+								utft_driver_ILI9486,
+								utft_driver_ILI9486_8,
+								utft_driver_CPLD,
+								utft_driver_HX8353C,
+								utft_driver_SPFD5420,
+								utft_driver_HX8357B,
+								utft_driver_HX8357C,
+								utft_driver_ILI9488,
+								utft_driver_ILI9488_8;
+
 class UTFT
 {
 	public:
 		UTFT();
-		UTFT(byte model, int RS, int WR, int CS, int RST, int SER=0);
+		__attribute__((always_inline)) UTFT(byte model, int RS, int WR, int CS, int RST, int SER=0)
+		{
+			_begin(_find_driver(model), model, RS, WR, CS, RST, SER);
+		}
 		void	InitLCD(byte orientation=LANDSCAPE);
+		void	beginInitLCD(byte orientation=LANDSCAPE);
+		boolean	updateInitLCD();
+		boolean	ready();
 		void	clrScr();
 		void	drawPixel(int x, int y);
 		void	drawLine(int x1, int y1, int x2, int y2);
@@ -226,16 +420,36 @@ class UTFT
 		void	setBackColor(byte r, byte g, byte b);
 		void	setBackColor(uint32_t color);
 		word	getBackColor();
-		void	print(char *st, int x, int y, int deg=0);
-		void	print(String st, int x, int y, int deg=0);
+		void	print(const char *st, int x, int y, int deg=0);
+		void	print(const String &st, int x, int y, int deg=0);
+#if defined(F)
+		void	print(const __FlashStringHelper *st, int x, int y, int deg=0);
+#endif
+		void	printScaled(const char *st, int x, int y, byte scale);
+#if defined(F)
+		void	printScaled(const __FlashStringHelper *st, int x, int y, byte scale);
+#endif
+		void	printNumI(int num, int x, int y, int length=0, char filler=' ');
+		void	printNumI(unsigned int num, int x, int y, int length=0, char filler=' ');
 		void	printNumI(long num, int x, int y, int length=0, char filler=' ');
+		void	printNumI(unsigned long num, int x, int y, int length=0, char filler=' ');
 		void	printNumF(double num, byte dec, int x, int y, char divider='.', int length=0, char filler=' ');
+		void	printNumFixed(long num, byte dec, int x, int y, char divider='.', int length=0, char filler=' ');
 		void	setFont(uint8_t* font);
+		void	setFont(assetptr font);
 		uint8_t* getFont();
+		assetptr getFontAddress();
 		uint8_t	getFontXsize();
 		uint8_t	getFontYsize();
 		void	drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int scale=1);
-		void	drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int deg, int rox, int roy);
+		void	drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int deg, int rox, int roy, uint32_t bgcolor=VGA_TRANSPARENT);
+		void	drawBitmap(int x, int y, int sx, int sy, assetptr data);
+		void	drawBitmapScaled(int x, int y, int sx, int sy, bitmapdatatype data, word scalex, word scaley);
+		void	drawCompressedBitmap(int x, int y, const uint8_t *data);
+		void	drawAtlasRegion(int x, int y, bitmapdatatype atlas, bitmapdatatype regions, int id);
+		void	drawAtlasRegion(int x, int y, bitmapdatatype atlas, int aw, int rx, int ry, int rw, int rh);
+		void	writePixels(int x, int y, int w, int h, const word *buf);
+		void	writePixels(int x, int y, int w, int h, void (*gen)(int col, int row, int n, word *buf));
 		void	lcdOff();
 		void	lcdOn();
 		void	setContrast(char c);
@@ -244,6 +458,15 @@ class UTFT
 		void	setBrightness(byte br);
 		void	setDisplayPage(byte page);
 		void	setWritePage(byte page);
+#if defined(UTFT_PROFILE)
+		void	resetProfile();
+		utft_profile_type getProfile(byte id);
+		utft_profile_type getProfileTotal();
+		const char *getProfileName(byte id);
+#if defined(ARDUINO)
+		void	printProfile(Print &out);
+#endif
+#endif
 
 /*
 	The functions and variables below should not normally be used.
@@ -255,14 +478,32 @@ class UTFT
 */
 		byte			fch, fcl, bch, bcl;
 		byte			orient;
-		long			disp_x_size, disp_y_size;
+		word			disp_x_size, disp_y_size;
 		byte			display_model, display_transfer_mode, display_serial_mode;
 		regtype			*P_RS, *P_WR, *P_CS, *P_RST, *P_SDA, *P_SCL, *P_ALE;
 		regsize			B_RS, B_WR, B_CS, B_RST, B_SDA, B_SCL, B_ALE;
 		byte			__p1, __p2, __p3, __p4, __p5;
 		_current_font	cfont;
 		boolean			_transparent;
+		boolean			_hw_spi;
+		word			_win_x1, _win_y1, _win_x2, _win_y2;
+		boolean			_win_valid;
+		boolean			_ready;
+		const uint8_t	*_init_pos;
+		unsigned long	_init_since;
+		byte			_init_wait;
+		byte			_rotation;
+		const utft_driver_type	*_driver;
+		void			(UTFT::*_setxy)(word x1, word y1, word x2, word y2);
+#if defined(UTFT_PROFILE)
+		utft_profile_type	profile[PROFILE_SLOTS];
+		byte			_profile_id;
+#endif
 
+		static const utft_driver_type *_find_driver(byte model) __attribute__((always_inline));
+		void _begin(const utft_driver_type *driver, byte model, int RS, int WR, int CS, int RST, int SER);
+		template <byte model> void _driver_init();
+		template <byte model> void _driver_setxy(word x1, word y1, word x2, word y2);
 		void LCD_Writ_Bus(char VH,char VL, byte mode);
 		//void LCD_Write_COM(char VL);
 		void LCD_Write_COM(int VL);
@@ -274,14 +515,192 @@ class UTFT
 		void setPixel(word color);
 		void drawHLine(int x, int y, int l);
 		void drawVLine(int x, int y, int l);
-		void printChar(byte c, int x, int y);
+		void printChar(word c, int x, int y);
+		void printCharScaled(word c, int x, int y, byte scale);
+		void _load_font();
+		word _glyph_offset(word c);
+		word _utf8_next(const char **st, boolean pgm);
+		int  _utf8_len(const char *st, boolean pgm);
+		int  _align_x(int x, int stl);
+		void _print_str(const char *st, boolean pgm, int stl, int x, int y, int deg);
+		void _print_num(unsigned long num, boolean neg, int x, int y, int length, char filler);
+		void _print_fixed(unsigned long num, boolean neg, byte dec, int x, int y, char divider, int length, char filler);
 		void setXY(word x1, word y1, word x2, word y2);
+		void _fill_screen(byte ch, byte cl, int w, int h);
+		void _set_window_dcs(word x1, word y1, word x2, word y2);
 		void clrXY();
-		void rotateChar(byte c, int x, int y, int pos, int deg);
+		void rotateChar(word c, int x, int y, int pos, int deg);
 		void _set_direction_registers(byte mode);
 		void _fast_fill_16(int ch, int cl, long pix);
 		void _fast_fill_8(int ch, long pix);
+		void _fast_fill_run(byte ch, byte cl, long pix);
+		void _write_run(const word *buf, int n, boolean reverse);
+		void _write_bitmap_run(bitmapdatatype data, int n, boolean reverse);
+		void _set_madctl();
+		word _bitmap_pixel(const uint8_t *src, byte bpp, const uint8_t *pal, long i);
 		void _convert_float(char *buf, double num, int width, byte prec);
 };
 
+inline const utft_driver_type *UTFT::_find_driver(byte model)
+{
+	switch (model)
+	{
+		case HX8347A:			return &utft_driver_HX8347A;
+		case ILI9327:			return &utft_driver_ILI9327;
+		case SSD1289:			return &utft_driver_SSD1289;
+		case SSD1289_8:			return &utft_driver_SSD1289_8;
+		case SSD1289LATCHED:	return &utft_driver_SSD1289LATCHED;
+		case ILI9325C:			return &utft_driver_ILI9325C;
+		case ILI9325D_8:		return &utft_driver_ILI9325D_8;
+		case ILI9325D_16:		return &utft_driver_ILI9325D_16;
+		case ILI9325D_16ALT:	return &utft_driver_ILI9325D_16ALT;
+		case HX8340B_8:			return &utft_driver_HX8340B_8;
+		case HX8340B_S:			return &utft_driver_HX8340B_S;
+		case HX8352A:			return &utft_driver_HX8352A;
+		case ST7735:			return &utft_driver_ST7735;
+		case ST7735_ALT:		return &utft_driver_ST7735_ALT;
+		case PCF8833:			return &utft_driver_PCF8833;
+		case S1D19122:			return &utft_driver_S1D19122;
+		case SSD1963_480:		return &utft_driver_SSD1963_480;
+		case SSD1963_800:		return &utft_driver_SSD1963_800;
+		case SSD1963_800ALT:	return &utft_driver_SSD1963_800ALT;
+		case S6D1121_8:			return &utft_driver_S6D1121_8;
+		case S6D1121_16:		return &utft_driver_S6D1121_16;
+		case ILI9481:			return &utft_driver_ILI9481;
+		case S6D0164:			return &utft_driver_S6D0164;
+		case ST7735S:			return &utft_driver_ST7735S;
+		case ILI9341_S4P:		return &utft_driver_ILI9341_S4P;
+		case ILI9341_S5P:		return &utft_driver_ILI9341_S5P;
+		case R61581:			return &utft_driver_R61581;
+		case ILI9486:			return &utft_driver_ILI9486;
+		case ILI9486_8:			return &utft_driver_ILI9486_8;
+		case CPLD:				return &utft_driver_CPLD;
+		case HX8353C:			return &utft_driver_HX8353C;
+		case SPFD5420:			return &utft_driver_SPFD5420;
+		case HX8357B:			return &utft_driver_HX8357B;
+		case HX8357C:			return &utft_driver_HX8357C;
+		case ILI9488:			return &utft_driver_ILI9488;
+		case ILI9488_8:			return &utft_driver_ILI9488_8;
+		default:				return NULL;
+	}
+}
+
+#if defined(UTFT_PROFILE)
+// Counts everything sent while it is in scope against id, unless an outer
+// scope is already counting, so drawRect() calling drawHLine() or
+// fillRoundRect() calling fillRect() is counted once, by the outer call.
+class UTFT_ProfileScope
+{
+	public:
+		UTFT_ProfileScope(UTFT *ptrUTFT, byte id)
+		{
+			_UTFT  = ptrUTFT;
+			_outer = ptrUTFT->_profile_id;
+			if (_outer==PROFILE_OTHER)
+			{
+				ptrUTFT->_profile_id = id;
+				ptrUTFT->profile[id].calls++;
+			}
+		}
+		~UTFT_ProfileScope()
+		{
+			_UTFT->_profile_id = _outer;
+		}
+
+	private:
+		UTFT	*_UTFT;
+		byte	_outer;
+};
+#endif
+
+// A UTFT whose model and orientation are fixed at compile time. Its size
+// and bus are constants, so layout arithmetic with width and height folds
+// to immediates, and the driver is selected without a lookup.
+//
+// clrScr() and fillScr() set the window and count the pixels with the
+// constant size, and print() centres and right-aligns with it. They hide
+// UTFT's versions rather than override them, so a call through a UTFT *,
+// as the add-on libraries make, runs UTFT's. The other drawing functions
+// are shared by every model and still clip and rotate with the RAM fields
+// disp_x_size, disp_y_size and orient.
+template <byte model, byte orientation=LANDSCAPE>
+class UTFT_Panel : public UTFT
+{
+	public:
+		static const byte	transfer_mode	= utft_model_type<model>::transfer_mode;
+		static const int	width	= ((orientation & 1) ? utft_model_type<model>::y_size : utft_model_type<model>::x_size)+1;
+		static const int	height	= ((orientation & 1) ? utft_model_type<model>::x_size : utft_model_type<model>::y_size)+1;
+
+		UTFT_Panel(int RS, int WR, int CS, int RST, int SER=0) : UTFT(model, RS, WR, CS, RST, SER)
+		{
+		}
+		void	InitLCD()
+		{
+			UTFT::InitLCD(orientation);
+		}
+		void	beginInitLCD()
+		{
+			UTFT::beginInitLCD(orientation);
+		}
+		void	clrScr()
+		{
+			if (!_ready)
+				return;
+			UTFT_PROFILE_SCOPE(this, PROFILE_CLRSCR);
+			_fill_screen(0, 0, width, height);
+		}
+		void	fillScr(byte r, byte g, byte b)
+		{
+			fillScr(word((r&248)<<8 | (g&252)<<3 | (b&248)>>3));
+		}
+		void	fillScr(word color)
+		{
+			if (!_ready)
+				return;
+			UTFT_PROFILE_SCOPE(this, PROFILE_FILLSCR);
+			_fill_screen(byte(color>>8), byte(color & 0xFF), width, height);
+		}
+		void	print(const char *st, int x, int y, int deg=0)
+		{
+			if (!_ready)
+				return;
+			UTFT_PROFILE_SCOPE(this, PROFILE_PRINT);
+			int	stl = _utf8_len(st, false);
+			_print_str(st, false, stl, _align(x, stl), y, deg);
+		}
+		void	print(const String &st, int x, int y, int deg=0)
+		{
+			print(st.c_str(), x, y, deg);
+		}
+#if defined(F)
+		void	print(const __FlashStringHelper *st, int x, int y, int deg=0)
+		{
+			if (!_ready)
+				return;
+			UTFT_PROFILE_SCOPE(this, PROFILE_PRINT);
+			PGM_P	p = reinterpret_cast<PGM_P>(st);
+			int		stl = _utf8_len(p, true);
+			_print_str(p, true, stl, _align(x, stl), y, deg);
+		}
+#endif
+		int		getDisplayXSize()
+		{
+			return width;
+		}
+		int		getDisplayYSize()
+		{
+			return height;
+		}
+
+	private:
+		int		_align(int x, int stl)
+		{
+			if (x==RIGHT)
+				return width-(stl*cfont.x_size);
+			if (x==CENTER)
+				return (width-(stl*cfont.x_size))/2;
+			return x;
+		}
+};
+
 #endif
\ No newline at end of file
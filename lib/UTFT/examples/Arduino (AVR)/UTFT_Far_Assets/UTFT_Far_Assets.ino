@@ -0,0 +1,104 @@
+// UTFT_Far_Assets
+//
+// This program shows how to use fonts and bitmaps by their flash
+// address, so they still work when they end up above the first 64Kb of
+// flash on an Arduino Mega 2560, and measures what that costs.
+//
+// It times reading the same 32x32 bitmap with near reads, far reads and
+// far reads in chunks, and drawing it with a pointer and with an
+// address. The results are shown on the display and sent to the serial
+// monitor at 9600 baud.
+//
+// Only setFont() and drawBitmap() can be given an address. Scaled,
+// atlas, compressed and sprite bitmaps are still read through a pointer
+// and have to stay in the first 64Kb of flash.
+//
+// This demo was made to work on the 480x320 modules.
+// Any other size displays may cause strange behaviour.
+//
+// This program requires the UTFT library.
+//
+
+#include <UTFT.h>
+#include <avr/pgmspace.h>
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+
+// Remember to change the model parameter to suit your display module!
+UTFT myGLCD(ILI9486,38,39,40,41);
+
+extern unsigned int tux[0x400];
+
+volatile word sink;
+
+unsigned long timeNear()
+{
+  unsigned long start=micros();
+  for (int i=0; i<0x400; i++)
+    sink=pgm_read_word(&tux[i]);
+  return micros()-start;
+}
+
+unsigned long timeFar()
+{
+  assetptr data=ASSET_ADDRESS(tux);
+  unsigned long start=micros();
+  for (int i=0; i<0x400; i++)
+    sink=asset_read_word(data+(i*2));
+  return micros()-start;
+}
+
+unsigned long timeChunked()
+{
+  assetptr data=ASSET_ADDRESS(tux);
+  word buf[ASSET_CHUNK];
+  unsigned long start=micros();
+  for (int i=0; i<0x400; i+=ASSET_CHUNK)
+  {
+    asset_read(buf, data+(i*2), ASSET_CHUNK*2);
+    for (int j=0; j<ASSET_CHUNK; j++)
+      sink=buf[j];
+  }
+  return micros()-start;
+}
+
+void show(int y, const char *label, unsigned long us)
+{
+  myGLCD.print(label, 10, y);
+  myGLCD.printNumI(us, 250, y, 6);
+  myGLCD.print("us", 300, y);
+  Serial.print(label);
+  Serial.print(": ");
+  Serial.print(us);
+  Serial.println(" us");
+}
+
+void setup()
+{
+  Serial.begin(9600);
+  myGLCD.InitLCD();
+  myGLCD.setFont(ASSET_ADDRESS(SmallFont));
+}
+
+void loop()
+{
+  unsigned long start;
+
+  myGLCD.clrScr();
+  myGLCD.setColor(255, 255, 255);
+  myGLCD.print("1024 words, read and discarded:", 10, 10);
+  show(30, "pgm_read_word()", timeNear());
+  show(45, "asset_read_word()", timeFar());
+  show(60, "asset_read() in chunks", timeChunked());
+
+  myGLCD.print("32x32 bitmap, drawn:", 10, 90);
+  start=micros();
+  myGLCD.drawBitmap(10, 110, 32, 32, tux);
+  show(150, "drawBitmap(pointer)", micros()-start);
+  start=micros();
+  myGLCD.drawBitmap(60, 110, 32, 32, ASSET_ADDRESS(tux));
+  show(165, "drawBitmap(address)", micros()-start);
+
+  delay(10000);
+}
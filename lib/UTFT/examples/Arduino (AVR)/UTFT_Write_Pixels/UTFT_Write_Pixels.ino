@@ -0,0 +1,91 @@
+// UTFT_Write_Pixels
+//
+// This program shows how to draw pixels that are computed at runtime
+// with writePixels(), both from a buffer in RAM and from a function that
+// makes the pixels a piece of a row at a time. It compares the time that
+// takes with drawing the same gradient with drawPixel().
+//
+// This demo was made to work on the 480x320 modules.
+// Any other size displays may cause strange behaviour.
+//
+// This program requires the UTFT library.
+//
+
+#include <UTFT.h>
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+
+// Remember to change the model parameter to suit your display module!
+UTFT myGLCD(ILI9486,38,39,40,41);
+
+#define W  200
+#define H  100
+
+word chart[64*48];
+int  phase = 0;
+
+// Red to blue from left to right, dark to bright from top to bottom
+word gradientColor(int col, int row)
+{
+  byte r = 255-(col*255L)/(W-1);
+  byte b = (col*255L)/(W-1);
+  byte g = (row*255L)/(H-1);
+  return ((r&248)<<8) | ((g&252)<<3) | (b>>3);
+}
+
+void gradient(int col, int row, int n, word *buf)
+{
+  for (int i=0; i<n; i++)
+    buf[i] = gradientColor(col+i, row);
+}
+
+void makeChart()
+{
+  for (int x=0; x<64; x++)
+  {
+    int v = 24+(int)(20*sin((x+phase)*0.2));
+    for (int y=0; y<48; y++)
+      chart[y*64+x] = (y==v) ? VGA_YELLOW : ((y % 8)==0 ? VGA_GRAY : VGA_BLACK);
+  }
+}
+
+void setup()
+{
+  myGLCD.InitLCD();
+  myGLCD.setFont(SmallFont);
+}
+
+void loop()
+{
+  unsigned long start, t1, t2;
+
+  myGLCD.clrScr();
+  myGLCD.setColor(255, 255, 255);
+
+  start = micros();
+  for (int y=0; y<H; y++)
+    for (int x=0; x<W; x++)
+    {
+      myGLCD.setColor(gradientColor(x, y));
+      myGLCD.drawPixel(10+x, 10+y);
+    }
+  t1 = micros()-start;
+
+  start = micros();
+  myGLCD.writePixels(10, 130, W, H, gradient);
+  t2 = micros()-start;
+
+  myGLCD.setColor(255, 255, 255);
+  myGLCD.print("drawPixel():", 230, 50);
+  myGLCD.printNumI(t1, 330, 50, 8);
+  myGLCD.print("writePixels():", 230, 170);
+  myGLCD.printNumI(t2, 330, 170, 8);
+
+  for (int i=0; i<100; i++)
+  {
+    makeChart();
+    myGLCD.writePixels(230, 240, 64, 48, chart);
+    phase++;
+  }
+}
@@ -1,6 +1,21 @@
+// Bus types for UTFT_BUS, and _spi_write()
+#include "HW_ATmega1280_bus.h"
+
 // *** Hardwarespecific functions ***
+
+// Serial modules with SDA on MOSI (D51) and SCL on SCK (D52) are driven by
+// the SPI module, in mode 3 at 8MHz, instead of toggling every bit. The
+// D/C bit in front of each byte in 4-pin mode is still clocked out by hand
+// with the SPI module switched off for that bit.
 void UTFT::_hw_special_init()
 {
+	_hw_spi = (display_transfer_mode==1) and (__p1==MOSI) and (__p2==SCK);
+	if (_hw_spi)
+	{
+		pinMode(SS, OUTPUT);
+		SPCR = _BV(SPE) | _BV(MSTR) | _BV(CPOL) | _BV(CPHA);
+		SPSR = _BV(SPI2X);
+	}
 }
 
 void UTFT::LCD_Writ_Bus(char VH,char VL, byte mode)
@@ -10,6 +25,8 @@ void UTFT::LCD_Writ_Bus(char VH,char VL, byte mode)
 	case 1:
 		if (display_serial_mode==SERIAL_4PIN)
 		{
+		if (_hw_spi)
+			SPCR &= ~_BV(SPE);
 		if (VH==1)
 			sbi(P_SDA, B_SDA);
 		else
@@ -23,6 +40,12 @@ void UTFT::LCD_Writ_Bus(char VH,char VL, byte mode)
 		else
 			cbi(P_RS, B_RS);
 		}
+		if (_hw_spi)
+		{
+			SPCR |= _BV(SPE);
+			_spi_write(VL);
+			break;
+		}
 
 		if (VL & 0x80)
 			sbi(P_SDA, B_SDA);
@@ -144,6 +167,7 @@ void UTFT::_fast_fill_16(int ch, int cl, long pix)
 		_fast_fill_8(ch, pix);
 	else
 	{
+		UTFT_PROFILE_ADD(this, wr, pix*2);
 		for (int i=0; i<pix; i++)
 		{
 			PORTG &= ~0x20;
@@ -169,6 +193,7 @@ void UTFT::_fast_fill_16(int ch, int cl, long pix)
 	PORTC = cl;
 
 	blocks = pix/16;
+	UTFT_PROFILE_ADD(this, wr, blocks*16+((pix % 16) ? (pix % 16)+1 : 0));
 	for (int i=0; i<blocks; i++)
 	{
 		pulse_low(P_WR, B_WR);
@@ -212,6 +237,7 @@ void UTFT::_fast_fill_8(int ch, long pix)
 #endif
 
 	blocks = pix/16;//for ILI9488_8
+	UTFT_PROFILE_ADD(this, wr, (blocks*16+((pix % 16) ? (pix % 16)+1 : 0))*2);
 	for (int i=0; i<blocks; i++)
 	{
 		pulse_low(P_WR, B_WR);pulse_low(P_WR, B_WR);
@@ -0,0 +1,357 @@
+// *** Compile-time bus types for the Arduino Mega ***
+//
+// A bus type sends commands, register values and pixels straight to the
+// ports, the same way LCD_Writ_Bus() does for its transfer mode, but
+// without testing display_transfer_mode and display_serial_mode on every
+// call. Select the one your module is wired for with UTFT_BUS, in
+// memorysaver.h or as a build flag; the constructor's model still has to
+// match it, or the display is never initialised.
+//
+// Estimated cycles per pixel at 16MHz, with the runtime LCD_Write_DATA()
+// for comparison. These are counted by hand from the instructions the
+// code should compile to, not measured on a board:
+//
+//						data	repeat	runtime
+//	UTFT_Bus16			~14		~6		~55
+//	UTFT_Bus8			~22		~12		~80
+//	UTFT_BusLatched16	~60		-		~115
+//	UTFT_BusSerial4		~300	-		~345
+//	UTFT_BusSerial5		~290	-		~335
+//	UTFT_BusSPI4		~65		~36		~80
+//	UTFT_BusSPI5		~45		~20		~60
+//
+// The SPI types need SDA on MOSI (D51) and SCL on SCK (D52). Their fills
+// keep the SPI module busy back to back: 4-pin fills send four pixels,
+// eight 9-bit frames, as nine whole bytes.
+//
+// repeat is sending the same pixel again while the data lines still hold
+// it, so only WR has to be pulsed. A dash means every pixel is a data().
+
+#ifndef HW_ATmega1280_bus_h
+#define HW_ATmega1280_bus_h
+
+static inline void _spi_write(byte VL)
+{
+	SPDR = VL;
+	while (!(SPSR & _BV(SPIF)));
+}
+
+struct UTFT_Bus16
+{
+	static const byte mode = 16;
+	static const byte serial = 0;
+
+	static inline void com(UTFT *t, int VL)
+	{
+		cbi(t->P_RS, t->B_RS);
+		PORTA = VL>>8;
+		PORTC = VL;
+		pulse_low(t->P_WR, t->B_WR);
+	}
+	static inline void param(UTFT *t, int VL)
+	{
+		sbi(t->P_RS, t->B_RS);
+		PORTA = VL>>8;
+		PORTC = VL;
+		pulse_low(t->P_WR, t->B_WR);
+	}
+	static inline void data(UTFT *t, byte VH, byte VL)
+	{
+		sbi(t->P_RS, t->B_RS);
+		PORTA = VH;
+		PORTC = VL;
+		pulse_low(t->P_WR, t->B_WR);
+	}
+	// Sends one pixel, returns true if pulsing WR sends it again
+	static inline boolean latch(UTFT *t, byte VH, byte VL)
+	{
+		data(t, VH, VL);
+		return true;
+	}
+	static inline void repeat(UTFT *t)
+	{
+		pulse_low(t->P_WR, t->B_WR);
+	}
+};
+
+struct UTFT_Bus8
+{
+	static const byte mode = 8;
+	static const byte serial = 0;
+
+	static inline void out(UTFT *t, byte v)
+	{
+#if defined(USE_UNO_SHIELD_ON_MEGA)
+		PORTG &= ~0x20;
+		PORTG |= (v & 0x10)<<1;
+		PORTH &= ~0x18;
+		PORTH |= (v & 0xC0)>>3;
+		PORTE &= ~0x3B;
+		PORTE |= (v & 0x03) + ((v & 0x0C)<<2) + ((v & 0x20)>>2);
+#else
+		PORTA = v;
+#endif
+		pulse_low(t->P_WR, t->B_WR);
+	}
+	// Same bytes as LCD_Writ_Bus(VH, VL, 8)
+	static inline void bus(UTFT *t, byte VH, byte VL)
+	{
+#if defined(USE_UNO_SHIELD_ON_MEGA)
+		out(t, VH);
+#else
+		(void)VH;
+#endif
+		out(t, VL);
+	}
+	static inline void com(UTFT *t, int VL)
+	{
+		cbi(t->P_RS, t->B_RS);
+		bus(t, VL>>8, VL);
+	}
+	static inline void param(UTFT *t, int VL)
+	{
+		sbi(t->P_RS, t->B_RS);
+		bus(t, VL>>8, VL);
+	}
+	static inline void data(UTFT *t, byte VH, byte VL)
+	{
+		sbi(t->P_RS, t->B_RS);
+		bus(t, 0, VH);
+		bus(t, 0, VL);
+	}
+	static inline boolean latch(UTFT *t, byte VH, byte VL)
+	{
+		data(t, VH, VL);
+#if defined(USE_UNO_SHIELD_ON_MEGA)
+		return false;
+#else
+		return (VH==VL);
+#endif
+	}
+	static inline void repeat(UTFT *t)
+	{
+		pulse_low(t->P_WR, t->B_WR);
+		pulse_low(t->P_WR, t->B_WR);
+	}
+};
+
+struct UTFT_BusLatched16
+{
+	static const byte mode = LATCHED_16;
+	static const byte serial = 0;
+
+	static inline void out(byte v)
+	{
+		PORTG &= ~0x20;
+		PORTG |= (v & 0x10)<<1;
+		PORTH &= ~0x18;
+		PORTH |= (v & 0xC0)>>3;
+		PORTE &= ~0x3B;
+		PORTE |= (v & 0x03) + ((v & 0x0C)<<2) + ((v & 0x20)>>2);
+	}
+	static inline void bus(UTFT *t, byte VH, byte VL)
+	{
+		out(VH);
+		cbi(t->P_ALE, t->B_ALE);
+		pulse_high(t->P_ALE, t->B_ALE);
+		cbi(t->P_CS, t->B_CS);
+		out(VL);
+		pulse_low(t->P_WR, t->B_WR);
+		sbi(t->P_CS, t->B_CS);
+	}
+	static inline void com(UTFT *t, int VL)
+	{
+		cbi(t->P_RS, t->B_RS);
+		bus(t, VL>>8, VL);
+	}
+	static inline void param(UTFT *t, int VL)
+	{
+		sbi(t->P_RS, t->B_RS);
+		bus(t, VL>>8, VL);
+	}
+	static inline void data(UTFT *t, byte VH, byte VL)
+	{
+		sbi(t->P_RS, t->B_RS);
+		bus(t, VH, VL);
+	}
+	static inline boolean latch(UTFT *t, byte VH, byte VL)
+	{
+		data(t, VH, VL);
+		return false;
+	}
+	static inline void repeat(UTFT *)
+	{
+	}
+};
+
+// The serial buses send a command/data flag with every byte: as a ninth
+// bit on SDA with 4 pins, or on RS with 5 pins.
+template <byte serial_mode, boolean spi>
+struct UTFT_BusSerial
+{
+	static const byte mode = 1;
+	static const byte serial = serial_mode;
+
+	static inline void bus(UTFT *t, byte dc, byte VL)
+	{
+		if (serial_mode==SERIAL_4PIN)
+		{
+			if (spi)
+				SPCR &= ~_BV(SPE);
+			if (dc)
+				sbi(t->P_SDA, t->B_SDA);
+			else
+				cbi(t->P_SDA, t->B_SDA);
+			pulse_low(t->P_SCL, t->B_SCL);
+		}
+		else
+		{
+			if (dc)
+				sbi(t->P_RS, t->B_RS);
+			else
+				cbi(t->P_RS, t->B_RS);
+		}
+		if (spi)
+		{
+			SPCR |= _BV(SPE);
+			_spi_write(VL);
+			return;
+		}
+		for (byte mask=0x80; mask; mask>>=1)
+		{
+			if (VL & mask)
+				sbi(t->P_SDA, t->B_SDA);
+			else
+				cbi(t->P_SDA, t->B_SDA);
+			pulse_low(t->P_SCL, t->B_SCL);
+		}
+	}
+	static inline void com(UTFT *t, int VL)
+	{
+		bus(t, 0, VL);
+	}
+	static inline void param(UTFT *t, int VL)
+	{
+		bus(t, 1, VL);
+	}
+	static inline void data(UTFT *t, byte VH, byte VL)
+	{
+		bus(t, 1, VH);
+		bus(t, 1, VL);
+	}
+	static inline boolean latch(UTFT *t, byte VH, byte VL)
+	{
+		data(t, VH, VL);
+		return false;
+	}
+	static inline void repeat(UTFT *)
+	{
+	}
+};
+
+typedef UTFT_BusSerial<SERIAL_4PIN, false> UTFT_BusSerial4;
+typedef UTFT_BusSerial<SERIAL_5PIN, false> UTFT_BusSerial5;
+typedef UTFT_BusSerial<SERIAL_4PIN, true> UTFT_BusSPI4;
+typedef UTFT_BusSerial<SERIAL_5PIN, true> UTFT_BusSPI5;
+
+// Sends exactly pix pixels of one color into the current window. With
+// UTFT_PROFILE, pixels sent again by pulsing WR are counted as WR pulses
+// and all others as data.
+template <class Bus>
+void _bus_fill(UTFT *t, byte ch, byte cl, long pix)
+{
+	if (pix<=0)
+		return;
+	UTFT_PROFILE_ADD(t, data, 1);
+	if (Bus::latch(t, ch, cl))
+	{
+		UTFT_PROFILE_ADD(t, wr, (pix-1)*(Bus::mode==8 ? 2 : 1));
+		pix--;
+		while (pix>=8)
+		{
+			Bus::repeat(t);	Bus::repeat(t);
+			Bus::repeat(t);	Bus::repeat(t);
+			Bus::repeat(t);	Bus::repeat(t);
+			Bus::repeat(t);	Bus::repeat(t);
+			pix-=8;
+		}
+		while (pix-->0)
+			Bus::repeat(t);
+	}
+	else
+	{
+		UTFT_PROFILE_ADD(t, data, pix-1);
+		while (--pix>0)
+			Bus::data(t, ch, cl);
+	}
+}
+
+// Each byte is written as soon as the previous one has left, so the panel
+// sees one continuous burst.
+template <>
+inline void _bus_fill<UTFT_BusSPI5>(UTFT *t, byte ch, byte cl, long pix)
+{
+	if (pix<=0)
+		return;
+	UTFT_PROFILE_ADD(t, data, pix);
+	sbi(t->P_RS, t->B_RS);
+	SPCR |= _BV(SPE);
+	SPDR = ch;
+	while (!(SPSR & _BV(SPIF)));
+	SPDR = cl;
+	while (--pix>0)
+	{
+		while (!(SPSR & _BV(SPIF)));
+		SPDR = ch;
+		while (!(SPSR & _BV(SPIF)));
+		SPDR = cl;
+	}
+	while (!(SPSR & _BV(SPIF)));
+}
+
+// Four pixels are eight frames of a D/C bit and a byte, 72 bits, which
+// pack into nine bytes that can be sent without switching the SPI module
+// off. The pixels that are left over go one by one.
+template <>
+inline void _bus_fill<UTFT_BusSPI4>(UTFT *t, byte ch, byte cl, long pix)
+{
+	byte	pat[9];
+	byte	i, n = 0, bits = 0;
+	word	acc = 0;
+	long	groups = pix/4;
+
+	if (pix<=0)
+		return;
+	UTFT_PROFILE_ADD(t, data, pix);
+	if (groups>0)
+	{
+		for (i=0; i<8; i++)
+		{
+			acc = (acc<<9) | 0x100 | ((i & 1) ? cl : ch);
+			bits += 9;
+			while (bits>=8)
+			{
+				bits -= 8;
+				pat[n++] = acc>>bits;
+			}
+		}
+		SPCR |= _BV(SPE);
+		SPDR = pat[0];
+		n = 1;
+		while (groups>0)
+		{
+			while (!(SPSR & _BV(SPIF)));
+			SPDR = pat[n];
+			if (++n==9)
+			{
+				n = 0;
+				groups--;
+			}
+		}
+		while (!(SPSR & _BV(SPIF)));
+	}
+	for (i=0; i<(pix & 3); i++)
+		UTFT_BusSPI4::data(t, ch, cl);
+}
+
+#endif
@@ -18,8 +18,37 @@
 
 #define swap(type, i, j) {type t = i; i = j; j = t;}
 
-#define fontbyte(x) pgm_read_byte(&cfont.font[x])  
+// Fonts and bitmaps can be addressed with an assetptr. On controllers
+// with more than 64Kb of flash it is a far address, so the asset can be
+// anywhere in flash. Get one with ASSET_ADDRESS(array).
+#if (FLASHEND>0xFFFF)
+	#define ASSET_FAR 1
+	#define assetptr uint_farptr_t
+	#define ASSET_ADDRESS(v) pgm_get_far_address(v)
+	#define asset_read_byte(a) pgm_read_byte_far(a)
+	#define asset_read_word(a) pgm_read_word_far(a)
+	#define asset_read(dst, a, len) memcpy_PF(dst, a, len)
+#else
+	#define assetptr uint16_t
+	#define ASSET_ADDRESS(v) ((assetptr)(v))
+	#define asset_read_byte(a) pgm_read_byte(a)
+	#define asset_read_word(a) pgm_read_word(a)
+	#define asset_read(dst, a, len) memcpy_P(dst, (const void*)(a), len)
+#endif
 
-#define regtype volatile uint8_t
+// A font that lies entirely in the first 64Kb of flash, which is where
+// the linker puts PROGMEM data first, is read with LPM through a 16bit
+// address. That saves the 32bit address arithmetic and the RAMPZ write of
+// a far read, about 7 cycles per byte against 3 for the test.
+#if defined(ASSET_FAR)
+	#define fontbyte(x) (cfont.lowflash ? pgm_read_byte((uint16_t)cfont.data+(x)) : asset_read_byte(cfont.data+(x)))
+#else
+	#define fontbyte(x) asset_read_byte(cfont.data+(x))
+#endif
+
+// The host build (test/host) brings its own register type
+#if !defined(regtype)
+	#define regtype volatile uint8_t
+#endif
 #define regsize uint8_t
 #define bitmapdatatype unsigned int*
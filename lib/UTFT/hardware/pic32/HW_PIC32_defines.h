@@ -17,7 +17,13 @@
 
 #define swap(type, i, j) {type t = i; i = j; j = t;}
 
-#define fontbyte(x) cfont.font[x]  
+#define assetptr uint32_t
+#define ASSET_ADDRESS(v) ((assetptr)(v))
+#define asset_read_byte(a) (*(const uint8_t*)(a))
+#define asset_read_word(a) (*(const uint16_t*)(a))
+#define asset_read(dst, a, len) memcpy(dst, (const void*)(a), len)
+
+#define fontbyte(x) asset_read_byte(cfont.data+(x))
 
 #define PROGMEM
 #define regtype volatile uint32_t
@@ -11,6 +11,10 @@
 // Uncomment the lines for the displaycontrollers that you don't use to save
 // some flash memory by not including the init code for that particular
 // controller.
+//
+// When the model passed to the constructor is a constant the linker already
+// leaves out the controllers that are not used, so this is only needed to
+// shorten the build or when the model is chosen at run time.
 
 //#define DISABLE_CPLD		 		1	// EHOUSE50CPLD
 
@@ -44,4 +48,26 @@
 //#define DISABLE_ST7735S			1	// TFT01_18SP
 //#define DISABLE_SPFD5420			1	// QDTFT Module for 3.2 inch
 //#define DISABLE_HX8357B			1	// QDTFT Module for 3.2 inch IPS 320X480
-//#define DISABLE_HX8357C			1	// QDTFT Module for 3.0 inch IPS 320X480
\ No newline at end of file
+//#define DISABLE_HX8357C			1	// QDTFT Module for 3.0 inch IPS 320X480
+// Bus type
+// --------
+//
+// If all your modules are wired the same way you can select the bus at
+// compile time. The drawing functions then write straight to the ports
+// instead of checking the transfer mode for every pixel, see the cycle
+// estimates in hardware/avr/HW_ATmega1280_bus.h. The model passed to the
+// constructor must use the same bus, a model on another bus is treated as
+// unknown and never initialised. Arduino Mega only.
+// Leave all lines commented out to select the bus at runtime as before.
+// A build flag can also choose it, e.g. -DUTFT_BUS=UTFT_Bus16 in the
+// build_flags of platformio.ini.
+
+#if !defined(UTFT_BUS)
+//#define UTFT_BUS	UTFT_Bus16			// 16bit parallel modules, like the CTE40
+//#define UTFT_BUS	UTFT_Bus8			// 8bit parallel modules
+//#define UTFT_BUS	UTFT_BusLatched16	// Latched 16bit modules
+//#define UTFT_BUS	UTFT_BusSerial4		// Serial modules with 4 pins
+//#define UTFT_BUS	UTFT_BusSerial5		// Serial modules with 5 pins
+//#define UTFT_BUS	UTFT_BusSPI4		// Serial modules with 4 pins, SDA on D51 and SCL on D52
+//#define UTFT_BUS	UTFT_BusSPI5		// Serial modules with 5 pins, SDA on D51 and SCL on D52
+#endif
@@ -1,4 +1,3 @@
-case HX8357B:
 	LCD_Write_COM(0x11);//Sleep Out  
 	delay(120);  
 	
@@ -105,4 +104,3 @@ case HX8357B:
 	LCD_Write_COM(0x29); //Display On
 	delay(5);
 
-	break;
@@ -1,4 +1,3 @@
-case HX8357C:
 //for Truly 3.0" LCD Panel
 	LCD_Write_COM(0XB9);//Set EXTC
 	LCD_Write_DATA(0xFF);
@@ -100,4 +99,3 @@ case HX8357C:
 	
 	delay(120);
 
-	break;
@@ -1,4 +1,3 @@
-case SPFD5420:
 	LCD_Write_COM(0x0000);  
     LCD_Write_DATA(0x0000); 
     LCD_Write_COM(0X0001);  
@@ -141,4 +140,3 @@ case SPFD5420:
     LCD_Write_DATA(0); 
     LCD_Write_COM(0x0201);  
     LCD_Write_DATA(0);
-	break;
@@ -1,4 +1,3 @@
-case SPFD5420:
 	LCD_Write_COM(0x210);	
 	LCD_Write_DATA(x1);
 	LCD_Write_COM(0x211);		
@@ -13,4 +12,3 @@ case SPFD5420:
 	LCD_Write_COM(0x201);	
 	LCD_Write_DATA(y1);
   LCD_Write_COM(0x202); 							 
-	break;
@@ -1,4 +1,3 @@
-case CPLD:
 	if (orient==LANDSCAPE)
 		orient = PORTRAIT;
 	else
@@ -7,4 +6,3 @@ case CPLD:
 	LCD_Write_COM(0x0F);   
 	LCD_Write_COM_DATA(0x01,0x0010);
 	LCD_Write_COM(0x0F);   
-	break;
@@ -0,0 +1,441 @@
+// Driver descriptors
+//
+// Every model has a utft_driver_type in flash, see UTFT.h, that points at
+// its driver's functions. The functions are made from the driver's
+// setxy.h and initlcd.h fragments. Models that only differ in the bus
+// share them.
+
+#define UTFT_MODEL_SIZE(model)	utft_model_type<model>::x_size, utft_model_type<model>::y_size, utft_model_type<model>::transfer_mode
+// Models disabled in memorysaver.h keep a descriptor without functions,
+// so UTFT::_find_driver() links for them too. _begin() treats them as an
+// unknown model.
+#define UTFT_DRIVER_DISABLED(model)	const utft_driver_type utft_driver_##model PROGMEM = {UTFT_MODEL_SIZE(model), NULL, NULL, NULL, NULL}
+
+#ifndef DISABLE_HX8347A
+template <> void UTFT::_driver_init<HX8347A>()
+{
+	#include "hx8347a/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<HX8347A>(word x1, word y1, word x2, word y2)
+{
+	#include "hx8347a/setxy.h"
+}
+const utft_driver_type utft_driver_HX8347A PROGMEM = {UTFT_MODEL_SIZE(HX8347A), NULL, &UTFT::_driver_init<HX8347A>, &UTFT::_driver_setxy<HX8347A>, NULL};
+#else
+UTFT_DRIVER_DISABLED(HX8347A);
+#endif
+
+#ifndef DISABLE_ILI9327
+template <> void UTFT::_driver_init<ILI9327>()
+{
+	#include "ili9327/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<ILI9327>(word x1, word y1, word x2, word y2)
+{
+	#include "ili9327/setxy.h"
+}
+const utft_driver_type utft_driver_ILI9327 PROGMEM = {UTFT_MODEL_SIZE(ILI9327), NULL, &UTFT::_driver_init<ILI9327>, &UTFT::_driver_setxy<ILI9327>, NULL};
+#else
+UTFT_DRIVER_DISABLED(ILI9327);
+#endif
+
+#ifndef DISABLE_SSD1289
+template <> void UTFT::_driver_init<SSD1289>()
+{
+	#include "ssd1289/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<SSD1289>(word x1, word y1, word x2, word y2)
+{
+	#include "ssd1289/setxy.h"
+}
+const utft_driver_type utft_driver_SSD1289 PROGMEM = {UTFT_MODEL_SIZE(SSD1289), NULL, &UTFT::_driver_init<SSD1289>, &UTFT::_driver_setxy<SSD1289>, NULL};
+const utft_driver_type utft_driver_SSD1289_8 PROGMEM = {UTFT_MODEL_SIZE(SSD1289_8), NULL, &UTFT::_driver_init<SSD1289>, &UTFT::_driver_setxy<SSD1289>, NULL};
+const utft_driver_type utft_driver_SSD1289LATCHED PROGMEM = {UTFT_MODEL_SIZE(SSD1289LATCHED), NULL, &UTFT::_driver_init<SSD1289>, &UTFT::_driver_setxy<SSD1289>, NULL};
+#else
+UTFT_DRIVER_DISABLED(SSD1289);
+UTFT_DRIVER_DISABLED(SSD1289_8);
+UTFT_DRIVER_DISABLED(SSD1289LATCHED);
+#endif
+
+#ifndef DISABLE_ILI9325C
+template <> void UTFT::_driver_init<ILI9325C>()
+{
+	#include "ili9325c/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<ILI9325C>(word x1, word y1, word x2, word y2)
+{
+	#include "ili9325c/setxy.h"
+}
+const utft_driver_type utft_driver_ILI9325C PROGMEM = {UTFT_MODEL_SIZE(ILI9325C), NULL, &UTFT::_driver_init<ILI9325C>, &UTFT::_driver_setxy<ILI9325C>, NULL};
+#else
+UTFT_DRIVER_DISABLED(ILI9325C);
+#endif
+
+#ifndef DISABLE_ILI9325D
+template <> void UTFT::_driver_init<ILI9325D_8>()
+{
+	#include "ili9325d/default/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<ILI9325D_8>(word x1, word y1, word x2, word y2)
+{
+	#include "ili9325d/default/setxy.h"
+}
+const utft_driver_type utft_driver_ILI9325D_8 PROGMEM = {UTFT_MODEL_SIZE(ILI9325D_8), NULL, &UTFT::_driver_init<ILI9325D_8>, &UTFT::_driver_setxy<ILI9325D_8>, NULL};
+const utft_driver_type utft_driver_ILI9325D_16 PROGMEM = {UTFT_MODEL_SIZE(ILI9325D_16), NULL, &UTFT::_driver_init<ILI9325D_8>, &UTFT::_driver_setxy<ILI9325D_8>, NULL};
+#else
+UTFT_DRIVER_DISABLED(ILI9325D_8);
+UTFT_DRIVER_DISABLED(ILI9325D_16);
+#endif
+
+#ifndef DISABLE_ILI9325D_ALT
+template <> void UTFT::_driver_init<ILI9325D_16ALT>()
+{
+	#include "ili9325d/alt/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<ILI9325D_16ALT>(word x1, word y1, word x2, word y2)
+{
+	#include "ili9325d/alt/setxy.h"
+}
+const utft_driver_type utft_driver_ILI9325D_16ALT PROGMEM = {UTFT_MODEL_SIZE(ILI9325D_16ALT), NULL, &UTFT::_driver_init<ILI9325D_16ALT>, &UTFT::_driver_setxy<ILI9325D_16ALT>, NULL};
+#else
+UTFT_DRIVER_DISABLED(ILI9325D_16ALT);
+#endif
+
+#ifndef DISABLE_HX8340B_8
+template <> void UTFT::_driver_init<HX8340B_8>()
+{
+	#include "hx8340b/8/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<HX8340B_8>(word x1, word y1, word x2, word y2)
+{
+	#include "hx8340b/8/setxy.h"
+}
+const utft_driver_type utft_driver_HX8340B_8 PROGMEM = {UTFT_MODEL_SIZE(HX8340B_8), NULL, &UTFT::_driver_init<HX8340B_8>, &UTFT::_driver_setxy<HX8340B_8>, NULL};
+#else
+UTFT_DRIVER_DISABLED(HX8340B_8);
+#endif
+
+#ifndef DISABLE_HX8340B_S
+template <> void UTFT::_driver_init<HX8340B_S>()
+{
+	#include "hx8340b/s/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<HX8340B_S>(word x1, word y1, word x2, word y2)
+{
+	#include "hx8340b/s/setxy.h"
+}
+const utft_driver_type utft_driver_HX8340B_S PROGMEM = {UTFT_MODEL_SIZE(HX8340B_S), NULL, &UTFT::_driver_init<HX8340B_S>, &UTFT::_driver_setxy<HX8340B_S>, NULL};
+#else
+UTFT_DRIVER_DISABLED(HX8340B_S);
+#endif
+
+#ifndef DISABLE_HX8352A
+template <> void UTFT::_driver_init<HX8352A>()
+{
+	#include "hx8352a/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<HX8352A>(word x1, word y1, word x2, word y2)
+{
+	#include "hx8352a/setxy.h"
+}
+const utft_driver_type utft_driver_HX8352A PROGMEM = {UTFT_MODEL_SIZE(HX8352A), NULL, &UTFT::_driver_init<HX8352A>, &UTFT::_driver_setxy<HX8352A>, NULL};
+#else
+UTFT_DRIVER_DISABLED(HX8352A);
+#endif
+
+#ifndef DISABLE_ST7735
+template <> void UTFT::_driver_init<ST7735>()
+{
+	#include "st7735/std/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<ST7735>(word x1, word y1, word x2, word y2)
+{
+	#include "st7735/std/setxy.h"
+}
+const utft_driver_type utft_driver_ST7735 PROGMEM = {UTFT_MODEL_SIZE(ST7735), NULL, &UTFT::_driver_init<ST7735>, &UTFT::_driver_setxy<ST7735>, NULL};
+#else
+UTFT_DRIVER_DISABLED(ST7735);
+#endif
+
+#ifndef DISABLE_ST7735_ALT
+template <> void UTFT::_driver_init<ST7735_ALT>()
+{
+	#include "st7735/alt/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<ST7735_ALT>(word x1, word y1, word x2, word y2)
+{
+	#include "st7735/alt/setxy.h"
+}
+const utft_driver_type utft_driver_ST7735_ALT PROGMEM = {UTFT_MODEL_SIZE(ST7735_ALT), NULL, &UTFT::_driver_init<ST7735_ALT>, &UTFT::_driver_setxy<ST7735_ALT>, NULL};
+#else
+UTFT_DRIVER_DISABLED(ST7735_ALT);
+#endif
+
+#ifndef DISABLE_PCF8833
+template <> void UTFT::_driver_init<PCF8833>()
+{
+	#include "pcf8833/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<PCF8833>(word x1, word y1, word x2, word y2)
+{
+	#include "pcf8833/setxy.h"
+}
+const utft_driver_type utft_driver_PCF8833 PROGMEM = {UTFT_MODEL_SIZE(PCF8833), NULL, &UTFT::_driver_init<PCF8833>, &UTFT::_driver_setxy<PCF8833>, NULL};
+#else
+UTFT_DRIVER_DISABLED(PCF8833);
+#endif
+
+#ifndef DISABLE_S1D19122
+template <> void UTFT::_driver_init<S1D19122>()
+{
+	#include "s1d19122/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<S1D19122>(word x1, word y1, word x2, word y2)
+{
+	#include "s1d19122/setxy.h"
+}
+const utft_driver_type utft_driver_S1D19122 PROGMEM = {UTFT_MODEL_SIZE(S1D19122), NULL, &UTFT::_driver_init<S1D19122>, &UTFT::_driver_setxy<S1D19122>, NULL};
+#else
+UTFT_DRIVER_DISABLED(S1D19122);
+#endif
+
+#ifndef DISABLE_SSD1963_480
+template <> void UTFT::_driver_init<SSD1963_480>()
+{
+	#include "ssd1963/480/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<SSD1963_480>(word x1, word y1, word x2, word y2)
+{
+	#include "ssd1963/480/setxy.h"
+}
+const utft_driver_type utft_driver_SSD1963_480 PROGMEM = {UTFT_MODEL_SIZE(SSD1963_480), NULL, &UTFT::_driver_init<SSD1963_480>, &UTFT::_driver_setxy<SSD1963_480>, NULL};
+#else
+UTFT_DRIVER_DISABLED(SSD1963_480);
+#endif
+
+#ifndef DISABLE_SSD1963_800
+template <> void UTFT::_driver_init<SSD1963_800>()
+{
+	#include "ssd1963/800/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<SSD1963_800>(word x1, word y1, word x2, word y2)
+{
+	#include "ssd1963/800/setxy.h"
+}
+const utft_driver_type utft_driver_SSD1963_800 PROGMEM = {UTFT_MODEL_SIZE(SSD1963_800), NULL, &UTFT::_driver_init<SSD1963_800>, &UTFT::_driver_setxy<SSD1963_800>, NULL};
+#else
+UTFT_DRIVER_DISABLED(SSD1963_800);
+#endif
+
+#ifndef DISABLE_SSD1963_800_ALT
+template <> void UTFT::_driver_init<SSD1963_800ALT>()
+{
+	#include "ssd1963/800alt/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<SSD1963_800ALT>(word x1, word y1, word x2, word y2)
+{
+	#include "ssd1963/800alt/setxy.h"
+}
+const utft_driver_type utft_driver_SSD1963_800ALT PROGMEM = {UTFT_MODEL_SIZE(SSD1963_800ALT), NULL, &UTFT::_driver_init<SSD1963_800ALT>, &UTFT::_driver_setxy<SSD1963_800ALT>, NULL};
+#else
+UTFT_DRIVER_DISABLED(SSD1963_800ALT);
+#endif
+
+#ifndef DISABLE_S6D1121
+template <> void UTFT::_driver_init<S6D1121_8>()
+{
+	#include "s6d1121/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<S6D1121_8>(word x1, word y1, word x2, word y2)
+{
+	#include "s6d1121/setxy.h"
+}
+const utft_driver_type utft_driver_S6D1121_8 PROGMEM = {UTFT_MODEL_SIZE(S6D1121_8), NULL, &UTFT::_driver_init<S6D1121_8>, &UTFT::_driver_setxy<S6D1121_8>, NULL};
+const utft_driver_type utft_driver_S6D1121_16 PROGMEM = {UTFT_MODEL_SIZE(S6D1121_16), NULL, &UTFT::_driver_init<S6D1121_8>, &UTFT::_driver_setxy<S6D1121_8>, NULL};
+#else
+UTFT_DRIVER_DISABLED(S6D1121_8);
+UTFT_DRIVER_DISABLED(S6D1121_16);
+#endif
+
+#ifndef DISABLE_ILI9481
+template <> void UTFT::_driver_init<ILI9481>()
+{
+	#include "ili9481/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<ILI9481>(word x1, word y1, word x2, word y2)
+{
+	#include "ili9481/setxy.h"
+}
+const utft_driver_type utft_driver_ILI9481 PROGMEM = {UTFT_MODEL_SIZE(ILI9481), NULL, &UTFT::_driver_init<ILI9481>, &UTFT::_driver_setxy<ILI9481>, NULL};
+#else
+UTFT_DRIVER_DISABLED(ILI9481);
+#endif
+
+#ifndef DISABLE_S6D0164
+template <> void UTFT::_driver_init<S6D0164>()
+{
+	#include "s6d0164/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<S6D0164>(word x1, word y1, word x2, word y2)
+{
+	#include "s6d0164/setxy.h"
+}
+const utft_driver_type utft_driver_S6D0164 PROGMEM = {UTFT_MODEL_SIZE(S6D0164), NULL, &UTFT::_driver_init<S6D0164>, &UTFT::_driver_setxy<S6D0164>, NULL};
+#else
+UTFT_DRIVER_DISABLED(S6D0164);
+#endif
+
+#ifndef DISABLE_ST7735S
+template <> void UTFT::_driver_init<ST7735S>()
+{
+	#include "st7735s/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<ST7735S>(word x1, word y1, word x2, word y2)
+{
+	#include "st7735s/setxy.h"
+}
+const utft_driver_type utft_driver_ST7735S PROGMEM = {UTFT_MODEL_SIZE(ST7735S), NULL, &UTFT::_driver_init<ST7735S>, &UTFT::_driver_setxy<ST7735S>, NULL};
+#else
+UTFT_DRIVER_DISABLED(ST7735S);
+#endif
+
+#ifndef DISABLE_ILI9341_S4P
+template <> void UTFT::_driver_init<ILI9341_S4P>()
+{
+	#include "ili9341/s4p/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<ILI9341_S4P>(word x1, word y1, word x2, word y2)
+{
+	#include "ili9341/s4p/setxy.h"
+}
+const utft_driver_type utft_driver_ILI9341_S4P PROGMEM = {UTFT_MODEL_SIZE(ILI9341_S4P), NULL, &UTFT::_driver_init<ILI9341_S4P>, &UTFT::_driver_setxy<ILI9341_S4P>, NULL};
+#else
+UTFT_DRIVER_DISABLED(ILI9341_S4P);
+#endif
+
+#ifndef DISABLE_ILI9341_S5P
+template <> void UTFT::_driver_init<ILI9341_S5P>()
+{
+	#include "ili9341/s5p/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<ILI9341_S5P>(word x1, word y1, word x2, word y2)
+{
+	#include "ili9341/s5p/setxy.h"
+}
+const utft_driver_type utft_driver_ILI9341_S5P PROGMEM = {UTFT_MODEL_SIZE(ILI9341_S5P), NULL, &UTFT::_driver_init<ILI9341_S5P>, &UTFT::_driver_setxy<ILI9341_S5P>, NULL};
+#else
+UTFT_DRIVER_DISABLED(ILI9341_S5P);
+#endif
+
+#ifndef DISABLE_R61581
+template <> void UTFT::_driver_init<R61581>()
+{
+	#include "r61581/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<R61581>(word x1, word y1, word x2, word y2)
+{
+	#include "r61581/setxy.h"
+}
+const utft_driver_type utft_driver_R61581 PROGMEM = {UTFT_MODEL_SIZE(R61581), NULL, &UTFT::_driver_init<R61581>, &UTFT::_driver_setxy<R61581>, NULL};
+#else
+UTFT_DRIVER_DISABLED(R61581);
+#endif
+
+#ifndef DISABLE_ILI9486
+#include "ili9486/inittable.h"
+template <> void UTFT::_driver_setxy<ILI9486>(word x1, word y1, word x2, word y2)
+{
+	#include "ili9486/setxy.h"
+}
+const utft_driver_type utft_driver_ILI9486 PROGMEM = {UTFT_MODEL_SIZE(ILI9486), ili9486_init_table, NULL, &UTFT::_driver_setxy<ILI9486>, ili9486_madctl};
+const utft_driver_type utft_driver_ILI9486_8 PROGMEM = {UTFT_MODEL_SIZE(ILI9486_8), ili9486_init_table, NULL, &UTFT::_driver_setxy<ILI9486>, ili9486_madctl};
+#else
+UTFT_DRIVER_DISABLED(ILI9486);
+UTFT_DRIVER_DISABLED(ILI9486_8);
+#endif
+
+#ifndef DISABLE_CPLD
+template <> void UTFT::_driver_init<CPLD>()
+{
+	#include "cpld/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<CPLD>(word x1, word y1, word x2, word y2)
+{
+	#include "cpld/setxy.h"
+}
+const utft_driver_type utft_driver_CPLD PROGMEM = {UTFT_MODEL_SIZE(CPLD), NULL, &UTFT::_driver_init<CPLD>, &UTFT::_driver_setxy<CPLD>, NULL};
+#else
+UTFT_DRIVER_DISABLED(CPLD);
+#endif
+
+#ifndef DISABLE_HX8353C
+template <> void UTFT::_driver_init<HX8353C>()
+{
+	#include "hx8353c/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<HX8353C>(word x1, word y1, word x2, word y2)
+{
+	#include "hx8353c/setxy.h"
+}
+const utft_driver_type utft_driver_HX8353C PROGMEM = {UTFT_MODEL_SIZE(HX8353C), NULL, &UTFT::_driver_init<HX8353C>, &UTFT::_driver_setxy<HX8353C>, NULL};
+#else
+UTFT_DRIVER_DISABLED(HX8353C);
+#endif
+
+#ifndef DISABLE_SPFD5420
+template <> void UTFT::_driver_init<SPFD5420>()
+{
+	#include "SPFD5420/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<SPFD5420>(word x1, word y1, word x2, word y2)
+{
+	#include "SPFD5420/setxy.h"
+}
+const utft_driver_type utft_driver_SPFD5420 PROGMEM = {UTFT_MODEL_SIZE(SPFD5420), NULL, &UTFT::_driver_init<SPFD5420>, &UTFT::_driver_setxy<SPFD5420>, NULL};
+#else
+UTFT_DRIVER_DISABLED(SPFD5420);
+#endif
+
+#ifndef DISABLE_HX8357B
+template <> void UTFT::_driver_init<HX8357B>()
+{
+	#include "HX8357B/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<HX8357B>(word x1, word y1, word x2, word y2)
+{
+	#include "HX8357B/setxy.h"
+}
+const utft_driver_type utft_driver_HX8357B PROGMEM = {UTFT_MODEL_SIZE(HX8357B), NULL, &UTFT::_driver_init<HX8357B>, &UTFT::_driver_setxy<HX8357B>, NULL};
+#else
+UTFT_DRIVER_DISABLED(HX8357B);
+#endif
+
+#ifndef DISABLE_HX8357C
+template <> void UTFT::_driver_init<HX8357C>()
+{
+	#include "HX8357C/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<HX8357C>(word x1, word y1, word x2, word y2)
+{
+	#include "HX8357C/setxy.h"
+}
+const utft_driver_type utft_driver_HX8357C PROGMEM = {UTFT_MODEL_SIZE(HX8357C), NULL, &UTFT::_driver_init<HX8357C>, &UTFT::_driver_setxy<HX8357C>, NULL};
+#else
+UTFT_DRIVER_DISABLED(HX8357C);
+#endif
+
+#ifndef DISABLE_ILI9488
+template <> void UTFT::_driver_init<ILI9488>()
+{
+	#include "ili9488/initlcd.h"
+}
+template <> void UTFT::_driver_setxy<ILI9488>(word x1, word y1, word x2, word y2)
+{
+	#include "ili9488/setxy.h"
+}
+const utft_driver_type utft_driver_ILI9488 PROGMEM = {UTFT_MODEL_SIZE(ILI9488), NULL, &UTFT::_driver_init<ILI9488>, &UTFT::_driver_setxy<ILI9488>, NULL};
+const utft_driver_type utft_driver_ILI9488_8 PROGMEM = {UTFT_MODEL_SIZE(ILI9488_8), NULL, &UTFT::_driver_init<ILI9488>, &UTFT::_driver_setxy<ILI9488>, NULL};
+#else
+UTFT_DRIVER_DISABLED(ILI9488);
+UTFT_DRIVER_DISABLED(ILI9488_8);
+#endif
@@ -1,4 +1,3 @@
-case HX8340B_8:
 	LCD_Write_COM_DATA(0x26,0x0084); //PT=10,GON=0, DTE=0, D=0100
 	delay(40);
 	LCD_Write_COM_DATA(0x26,0x00B8); //PT=10,GON=1, DTE=1, D=1000
@@ -77,4 +76,3 @@ case HX8340B_8:
 	LCD_Write_COM_DATA(0x17,0x0005);//COLMOD Control Register (R17h)
 	LCD_Write_COM(0x21);
 	LCD_Write_COM(0x22);
-	break;
@@ -1,4 +1,3 @@
-case HX8340B_S:
 	LCD_Write_COM(0xC1); 
 	LCD_Write_DATA(0xFF);
 	LCD_Write_DATA(0x83);
@@ -68,4 +67,3 @@ case HX8340B_S:
 	LCD_Write_DATA(0x00); 
 	LCD_Write_DATA(0xdb); 
 	LCD_Write_COM(0x2c); 
-	break;
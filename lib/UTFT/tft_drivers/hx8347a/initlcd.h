@@ -1,4 +1,3 @@
-case HX8347A:
 	LCD_Write_COM_DATA(0x46,0x00A4);
 	LCD_Write_COM_DATA(0x47,0x0053);
 	LCD_Write_COM_DATA(0x48,0x0000);
@@ -85,4 +84,3 @@ case HX8347A:
 	LCD_Write_COM_DATA(0x57,0x0000); // TEST_Mode=0: exit TEST mode
 	//LCD_Write_COM_DATA(0x21,0x0000);
 	LCD_Write_COM(0x22);   
-	break;
@@ -1,4 +1,3 @@
-case HX8352A:
 	LCD_Write_COM(0x83);           
 	LCD_Write_DATA(0x02);  //TESTM=1 
              
@@ -128,4 +127,3 @@ case HX8352A:
 	LCD_Write_DATA(0x8f);
 
 	LCD_Write_COM(0x22);
-	break;
@@ -1,4 +1,3 @@
-case HX8352A:
 	LCD_Write_COM_DATA(0x02,x1>>8);
 	LCD_Write_COM_DATA(0x03,x1);
 	LCD_Write_COM_DATA(0x04,x2>>8);
@@ -8,4 +7,3 @@ case HX8352A:
 	LCD_Write_COM_DATA(0x08,y2>>8);
 	LCD_Write_COM_DATA(0x09,y2);
 	LCD_Write_COM(0x22);      
-	break;
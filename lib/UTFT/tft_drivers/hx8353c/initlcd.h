@@ -1,4 +1,3 @@
-case HX8353C:
 	LCD_Write_COM(0xB9);//SETEXTC
 		LCD_Write_DATA(0xFF);
 		LCD_Write_DATA(0x83);
@@ -66,4 +65,3 @@ case HX8353C:
 
 		LCD_Write_COM(0x2c);  
 		delay(150);	 
-	break;
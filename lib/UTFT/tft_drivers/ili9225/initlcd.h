@@ -1,4 +1,3 @@
-case ILI9225:
 	LCD_Write_COM_DATA(0x01,0x011c);
 	LCD_Write_COM_DATA(0x02,0x0100);
 	LCD_Write_COM_DATA(0x03,0x1038);
@@ -42,4 +41,3 @@ case ILI9225:
 	delay(50);                                     // Delay 50ms
 	LCD_Write_COM_DATA(0x07,0x1017);
 	LCD_Write_COM(0x22);
-break;
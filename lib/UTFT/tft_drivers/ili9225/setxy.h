@@ -1,4 +1,3 @@
-case ILI9225:	
 	LCD_Write_COM_DATA(0x36,x2);
 	LCD_Write_COM_DATA(0x37,x1);
 	LCD_Write_COM_DATA(0x38,y2);
@@ -6,4 +5,3 @@ case ILI9225:
 	LCD_Write_COM_DATA(0x20,x1);
 	LCD_Write_COM_DATA(0x21,y1);
 	LCD_Write_COM(0x22); 
-	break;
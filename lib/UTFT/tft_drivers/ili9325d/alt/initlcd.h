@@ -1,4 +1,3 @@
-case ILI9325D_16ALT:
 	LCD_Write_COM_DATA(0xE5, 0x78F0); // set SRAM internal timing
 	LCD_Write_COM_DATA(0x01, 0x0100); // set Driver Output Control  
 	LCD_Write_COM_DATA(0x02, 0x0700); // set 1 line inversion  
@@ -58,4 +57,3 @@ case ILI9325D_16ALT:
 	LCD_Write_COM_DATA(0x90, 0x0010);  
 	LCD_Write_COM_DATA(0x92, 0x0000);  
 	LCD_Write_COM_DATA(0x07, 0x0133); // 262K color and display ON        
-	break;
@@ -1,4 +1,3 @@
-case ILI9327:
 	LCD_Write_COM(0xE9);
 	LCD_Write_DATA(0x00,0x20);
 	LCD_Write_COM(0x11); //Exit Sleep
@@ -60,4 +59,3 @@ case ILI9327:
 	LCD_Write_DATA(0x00,0x8F);
 	LCD_Write_COM(0x29); //display on      
 	LCD_Write_COM(0x2C); //display on
-	break;
@@ -1,4 +1,3 @@
-case ILI9327:
 	LCD_Write_COM(0x2a);
   	LCD_Write_DATA(0x00,x1>>8);
   	LCD_Write_DATA(0x00,x1);
@@ -10,4 +9,3 @@ case ILI9327:
   	LCD_Write_DATA(0x00,y2>>8);
   	LCD_Write_DATA(0x00,y2);
   	LCD_Write_COM(0x2c); 							 
-	break;
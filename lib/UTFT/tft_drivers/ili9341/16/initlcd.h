@@ -1,4 +1,3 @@
-case ILI9341_16:
     LCD_Write_COM(0xCB);  
     LCD_Write_DATA(0x39); 
     LCD_Write_DATA(0x2C); 
@@ -102,4 +101,3 @@ case ILI9341_16:
 				
     LCD_Write_COM(0x29);    //Display on 
     LCD_Write_COM(0x2c); 
-	break;
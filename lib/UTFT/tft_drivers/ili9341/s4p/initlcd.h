@@ -1,4 +1,3 @@
-case ILI9341_S4P:
 	LCD_Write_COM(0x11);//sleep out 
 	delay(20);
   //LCD_Write_COM(0x01); //reset
@@ -55,4 +54,3 @@ case ILI9341_S4P:
   //LCD_Write_DATA((1<<3)|(1<<7)); //rotate 180
   LCD_Write_COM(0x29); //display on
   delay(5);
-	break;
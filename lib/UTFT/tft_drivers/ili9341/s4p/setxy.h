@@ -1,13 +1 @@
-case ILI9341_S4P:
-	LCD_Write_COM(0x2A); //column
-	LCD_Write_DATA(x1>>8);
-	LCD_Write_DATA(x1);
-	LCD_Write_DATA(x2>>8);
-	LCD_Write_DATA(x2);
-	LCD_Write_COM(0x2B); //page
-	LCD_Write_DATA(y1>>8);
-	LCD_Write_DATA(y1);
-	LCD_Write_DATA(y2>>8);
-	LCD_Write_DATA(y2);
-	LCD_Write_COM(0x2C); //write
-	break;
+	_set_window_dcs(x1, y1, x2, y2);
@@ -1,4 +1,3 @@
-case ILI9481:
 	LCD_Write_COM(0x11);
 	delay(20);
 	LCD_Write_COM(0xD0);
@@ -59,4 +58,3 @@ case ILI9481:
 	LCD_Write_DATA(0xE0);
 	delay(120);
 	LCD_Write_COM(0x29);
-	break;
@@ -0,0 +1,53 @@
+// ILI9486 / ILI9486_8
+//
+// Waits are the datasheet minimums: RESX low for 10us, 120ms after reset
+// before Sleep Out may be sent and 5ms after Sleep Out before the next
+// command. The registers take effect as they are written. Memory Access
+// Control is sent after the table, for the orientation.
+const uint8_t ili9486_init_table[] PROGMEM = {
+	10, 120,					// Reset low 10us, then 120ms
+
+	0x11, INIT_DELAY | 0, 5,	// Sleep OUT
+
+	0xF2, 9,					// ?????
+		0x1C, 0xA3, 0x32, 0x02, 0xB2, 0x12, 0xFF, 0x12, 0x00,
+	0xF1, 2,					// ?????
+		0x36, 0xA4,
+	0xF8, 2,					// ?????
+		0x21, 0x04,
+	0xF9, 2,					// ?????
+		0x00, 0x08,
+	0xC0, 2,					// Power Control 1
+		0x0D, 0x0D,
+	0xC1, 2,					// Power Control 2
+		0x43, 0x00,
+	0xC2, 1,					// Power Control 3
+		0x00,
+	0xC5, 2,					// VCOM Control
+		0x00, 0x48,
+	0xB6, 3,					// Display Function Control
+		0x00, 0x22, 0x3B,		// 0x42 = Rotate display 180 deg.
+	0xE0, 15,					// PGAMCTRL (Positive Gamma Control)
+		0x0F, 0x24, 0x1C, 0x0A, 0x0F, 0x08, 0x43, 0x88,
+		0x32, 0x0F, 0x10, 0x06, 0x0F, 0x07, 0x00,
+	0xE1, 15,					// NGAMCTRL (Negative Gamma Control)
+		0x0F, 0x38, 0x30, 0x09, 0x0F, 0x0F, 0x4E, 0x77,
+		0x3C, 0x07, 0x10, 0x05, 0x23, 0x1B, 0x00,
+	0x20, 1,					// Display Inversion OFF
+		0x00,
+	0x3A, 1,					// Interface Pixel Format
+		0x55,
+	0x2A, 4,					// Column Addess Set
+		0x00, 0x00, 0x01, 0xDF,
+	0x2B, 4,					// Page Address Set
+		0x00, 0x00, 0x01, 0x3F,
+	0x29, 0,					// Display ON
+	0x2C, 0,					// Memory Write
+
+	INIT_END
+};
+
+// Memory Access Control for PORTRAIT, LANDSCAPE, PORTRAIT_FLIPPED and
+// LANDSCAPE_FLIPPED. The landscape values exchange rows and columns (MV),
+// and the flipped ones mirror both the rows (MY) and the columns (MX).
+const uint8_t ili9486_madctl[] PROGMEM = {0x0A, 0x6A, 0xCA, 0xAA};
@@ -1,5 +1,3 @@
-case ILI9488:
-case ILI9488_8:
 	LCD_Write_COM(0XF7);
 	LCD_Write_DATA(0xA9);
 	LCD_Write_DATA(0x51);
@@ -82,4 +80,3 @@ case ILI9488_8:
 	LCD_Write_COM(0x11);
 	delay(120);
 	LCD_Write_COM(0x29);
-	break;
@@ -1,4 +1,3 @@
-case PCF8833:
 	LCD_Write_COM(0x01);
 	LCD_Write_COM(0x25);
 	LCD_Write_DATA(0x40);
@@ -27,4 +26,3 @@ case PCF8833:
 	LCD_Write_DATA(0x00);
 	LCD_Write_DATA(0x7F);
 	LCD_Write_COM(0x2C);
-	break;
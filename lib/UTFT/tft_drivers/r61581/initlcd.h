@@ -1,4 +1,3 @@
-case R61581:
 		LCD_Write_COM(0xB0);		
 		LCD_Write_DATA(0x1E);	    
 
@@ -107,4 +106,3 @@ case R61581:
 
 		LCD_Write_COM(0x2C);
 		delay(30);
-		break;
@@ -1,4 +1,3 @@
-case S1D19122:
 	//************* Start Initial Sequence **********//
 
 	int i,R,G,B;
@@ -180,4 +179,3 @@ case S1D19122:
 		LCD_Write_DATA(B);
 		B=B+2;
 	}    
-	break;
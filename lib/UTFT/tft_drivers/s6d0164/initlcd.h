@@ -1,4 +1,3 @@
-case S6D0164:
 	LCD_Write_COM_DATA(0x11,0x001A);
 	LCD_Write_COM_DATA(0x12,0x3121);
 	LCD_Write_COM_DATA(0x13,0x006C);
@@ -41,4 +40,3 @@ case S6D0164:
 	LCD_Write_COM_DATA(0x07,0x0017);
 
 	LCD_Write_COM(0x22);
-	break;
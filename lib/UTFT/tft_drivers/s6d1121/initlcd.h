@@ -1,5 +1,3 @@
-case S6D1121_8:
-case S6D1121_16:
 	LCD_Write_COM_DATA(0x11,0x2004);		
 	LCD_Write_COM_DATA(0x13,0xCC00);		
 	LCD_Write_COM_DATA(0x15,0x2600);	
@@ -44,4 +42,3 @@ case S6D1121_16:
 	LCD_Write_COM_DATA(0x07,0x0053);		
 	LCD_Write_COM_DATA(0x79,0x0000);
 	LCD_Write_COM(0x22);
-	break;
@@ -1,6 +1,3 @@
-case SSD1289:
-case SSD1289_8:
-case SSD1289LATCHED:
 	LCD_Write_COM_DATA(0x00,0x0001);
 	LCD_Write_COM_DATA(0x03,0xA8A4);
 	LCD_Write_COM_DATA(0x0C,0x0000);
@@ -43,4 +40,3 @@ case SSD1289LATCHED:
 	LCD_Write_COM_DATA(0x4f,0x0000);
 	LCD_Write_COM_DATA(0x4e,0x0000);
 	LCD_Write_COM(0x22);   
-	break;
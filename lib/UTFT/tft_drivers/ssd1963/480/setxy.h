@@ -1,4 +1,3 @@
-case SSD1963_480:
 	swap(word, x1, y1);
 	swap(word, x2, y2);
 	LCD_Write_COM(0x2a); 
@@ -12,4 +11,3 @@ case SSD1963_480:
   	LCD_Write_DATA(y2>>8);
   	LCD_Write_DATA(y2);
 	LCD_Write_COM(0x2c); 
-	break;
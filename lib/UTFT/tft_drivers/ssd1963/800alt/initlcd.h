@@ -1,4 +1,3 @@
-case SSD1963_800ALT:
 	LCD_Write_COM(0xE2);		//PLL multiplier, set PLL clock to 120M
 	LCD_Write_DATA(0x23);	    //N=0x36 for 6.5M, 0x23 for 10M crystal
 	LCD_Write_DATA(0x02);
@@ -75,4 +74,3 @@ case SSD1963_800ALT:
 	LCD_Write_DATA(0x0D);	
 
 	LCD_Write_COM(0x2C); 
-	break;
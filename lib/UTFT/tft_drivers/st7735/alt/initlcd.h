@@ -1,4 +1,3 @@
-case ST7735_ALT:
 	LCD_Write_COM(0x11);//Sleep exit 
 	delay(12);
  
@@ -101,4 +100,3 @@ case ST7735_ALT:
 	LCD_Write_COM(0x3A); //65k mode 
 	LCD_Write_DATA(0x05); 
 	LCD_Write_COM(0x29);//Display on
-	break;
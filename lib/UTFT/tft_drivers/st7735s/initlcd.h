@@ -1,4 +1,3 @@
-case ST7735S:
 	LCD_Write_COM(0x11);//Sleep exit 
 	delay(120);
  
@@ -95,4 +94,3 @@ case ST7735S:
 	LCD_Write_COM(0x3A); //65k mode 
 	LCD_Write_DATA(0x05); 
 	LCD_Write_COM(0x29);//Display on
-	break;
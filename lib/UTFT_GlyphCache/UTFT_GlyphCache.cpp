@@ -0,0 +1,222 @@
+/*
+  UTFT_GlyphCache.cpp - Add-on Library for UTFT: Glyph Cache
+
+  This library keeps a small, fixed-size cache in RAM of recently drawn
+  characters. Each entry holds the character already decoded into runs
+  of foreground and background pixels, so drawing it again does not
+  need to read the font from flash or test every bit.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the CC BY-NC-SA 3.0 license.
+  Please see the included documents for further information.
+*/
+
+#include "UTFT_GlyphCache.h"
+#include <UTFT.h>
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#endif
+
+UTFT_GlyphCache::UTFT_GlyphCache(UTFT *ptrUTFT)
+{
+	_UTFT = ptrUTFT;
+	clearCache();
+	resetStats();
+}
+
+void UTFT_GlyphCache::clearCache()
+{
+	for (int i=0; i<GLYPHCACHE_SLOTS; i++)
+	{
+		slots[i].font  = 0;
+		slots[i].len   = 0;
+		slots[i].stamp = 0;
+	}
+	_tick = 0;
+	_orient = _UTFT->orient;
+}
+
+unsigned long UTFT_GlyphCache::getHits()
+{
+	return _hits;
+}
+
+unsigned long UTFT_GlyphCache::getMisses()
+{
+	return _misses;
+}
+
+void UTFT_GlyphCache::resetStats()
+{
+	_hits = 0;
+	_misses = 0;
+}
+
+void UTFT_GlyphCache::print(const char *st, int x, int y)
+{
+	UTFT_PROFILE_SCOPE(_UTFT, PROFILE_GLYPHCACHE);
+	int stl, i;
+	int xs = _UTFT->cfont.x_size;
+
+	stl = _UTFT->_utf8_len(st, false);
+	x = _UTFT->_align_x(x, stl);
+
+	for (i=0; i<stl; i++)
+		printChar(_UTFT->_utf8_next(&st, false), x + (i*xs), y);
+}
+
+void UTFT_GlyphCache::printChar(word c, int x, int y)
+{
+	word	fg = _UTFT->getColor();
+	word	bg = _UTFT->getBackColor();
+	int		slot;
+
+	if (!_UTFT->ready())
+		return;
+	if (_UTFT->_transparent)
+	{
+		_UTFT->printChar(c, x, y);
+		return;
+	}
+
+	// Runs are stored in the order of the orientation they were decoded
+	// for, so they are all dropped when it changes
+	if (_UTFT->orient!=_orient)
+		clearCache();
+
+	// Restart the LRU clock before it wraps; the order is only lost once
+	// every 65535 characters.
+	if (_tick==0xFFFF)
+	{
+		for (int i=0; i<GLYPHCACHE_SLOTS; i++)
+			slots[i].stamp = 0;
+		_tick = 0;
+	}
+	_tick++;
+
+	slot = _findSlot(c, fg, bg);
+	if (slot>=0)
+		_hits++;
+	else
+	{
+		_misses++;
+		slot = _decodeGlyph(c, fg, bg);
+		if (slot<0)
+		{
+			_UTFT->printChar(c, x, y);
+			return;
+		}
+	}
+	slots[slot].stamp = _tick;
+	_drawSlot(slot, x, y);
+}
+
+int UTFT_GlyphCache::_findSlot(word c, word fg, word bg)
+{
+	for (int i=0; i<GLYPHCACHE_SLOTS; i++)
+		if ((slots[i].font==_UTFT->cfont.data) and (slots[i].c==c) and (slots[i].fg==fg) and (slots[i].bg==bg))
+			return i;
+	return -1;
+}
+
+// Decodes a character into the least recently used slot. Each row is
+// stored as alternating background/foreground run lengths, starting with
+// background, in the order UTFT::printChar() sends the pixels for the
+// current orientation. Returns -1 if the character does not fit.
+int UTFT_GlyphCache::_decodeGlyph(word c, word fg, word bg)
+{
+	byte	xb = _UTFT->cfont.x_size/8;
+	byte	ys = _UTFT->cfont.y_size;
+	byte	*runs;
+	byte	len, cnt, ch, bit;
+	boolean	color, on;
+	word	temp;
+	int		slot = 0;
+
+	temp = _UTFT->_glyph_offset(c);
+	if ((temp==0) or (ys>GLYPHCACHE_SLOT_SIZE))
+		return -1;
+
+	for (int i=1; i<GLYPHCACHE_SLOTS; i++)
+		if (slots[i].stamp<slots[slot].stamp)
+			slot = i;
+
+	slots[slot].font = 0;
+	runs = slots[slot].runs;
+	len = 0;
+	for (byte row=0; row<ys; row++)
+	{
+		color = false;
+		cnt = 0;
+		for (byte b=0; b<xb; b++)
+		{
+			if (_UTFT->orient==PORTRAIT)
+				ch = asset_read_byte(_UTFT->cfont.data+temp+b);
+			else
+				ch = asset_read_byte(_UTFT->cfont.data+temp+xb-1-b);
+			for (byte i=0; i<8; i++)
+			{
+				if (_UTFT->orient==PORTRAIT)
+					bit = 0x80>>i;
+				else
+					bit = 0x01<<i;
+				on = ((ch & bit)!=0);
+				if (on==color)
+					cnt++;
+				else
+				{
+					if (len==GLYPHCACHE_SLOT_SIZE)
+						return -1;
+					runs[len++] = cnt;
+					color = on;
+					cnt = 1;
+				}
+			}
+		}
+		if (len==GLYPHCACHE_SLOT_SIZE)
+			return -1;
+		runs[len++] = cnt;
+		temp += xb;
+	}
+
+	slots[slot].font   = _UTFT->cfont.data;
+	slots[slot].c      = c;
+	slots[slot].fg     = fg;
+	slots[slot].bg     = bg;
+	slots[slot].len    = len;
+	return slot;
+}
+
+void UTFT_GlyphCache::_drawSlot(int slot, int x, int y)
+{
+	byte	xs = _UTFT->cfont.x_size;
+	byte	ys = _UTFT->cfont.y_size;
+	byte	*runs = slots[slot].runs;
+	byte	fch = _UTFT->fch, fcl = _UTFT->fcl;
+	byte	bch = _UTFT->bch, bcl = _UTFT->bcl;
+	byte	i = 0;
+	word	px;
+	boolean	color;
+
+	cbi(_UTFT->P_CS, _UTFT->B_CS);
+	if (_UTFT->orient==PORTRAIT)
+		_UTFT->setXY(x, y, x+xs-1, y+ys-1);
+	for (byte row=0; row<ys; row++)
+	{
+		if (_UTFT->orient!=PORTRAIT)
+			_UTFT->setXY(x, y+row, x+xs-1, y+row);
+		color = false;
+		px = 0;
+		while (px<xs)
+		{
+			if (color)
+				_UTFT->_fast_fill_run(fch, fcl, runs[i]);
+			else
+				_UTFT->_fast_fill_run(bch, bcl, runs[i]);
+			px += runs[i++];
+			color = !color;
+		}
+	}
+	sbi(_UTFT->P_CS, _UTFT->B_CS);
+	_UTFT->clrXY();
+}
@@ -0,0 +1,78 @@
+/*
+  UTFT_GlyphCache.h - Add-on Library for UTFT: Glyph Cache
+
+  This library keeps a small, fixed-size cache in RAM of recently drawn
+  characters. Each entry holds the character already decoded into runs
+  of foreground and background pixels, so drawing it again does not
+  need to read the font from flash or test every bit.
+
+  The cache is sized at compile time. The defaults hold 12 characters in
+  about 1.1Kb of RAM, enough for the 11 different characters of the two
+  team labels in main.cpp. Set GLYPHCACHE_SLOTS and GLYPHCACHE_SLOT_SIZE
+  with build flags, e.g. -DGLYPHCACHE_SLOTS=8, to use more or less.
+  Characters that do not fit in a single entry, or that are drawn with a
+  transparent background, are passed on to UTFT unchanged.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the CC BY-NC-SA 3.0 license.
+  Please see the included documents for further information.
+*/
+
+#ifndef UTFT_GlyphCache_h
+#define UTFT_GlyphCache_h
+
+#if defined(__AVR__)
+	#include "Arduino.h"
+#elif defined(__PIC32MX__)
+	#include "WProgram.h"
+#elif defined(__arm__)
+	#include "Arduino.h"
+#endif
+
+#include <UTFT.h>
+#if ((!defined(UTFT_VERSION)) || (UTFT_VERSION<279))
+	#error : You will need UTFT v2.79 or higher to use this add-on library...
+#endif
+
+#ifndef GLYPHCACHE_SLOTS
+	#define GLYPHCACHE_SLOTS		12	// Number of characters kept in the cache
+#endif
+#ifndef GLYPHCACHE_SLOT_SIZE
+	#define GLYPHCACHE_SLOT_SIZE	84	// Bytes of run data available to each character
+#endif
+
+typedef struct
+{
+	assetptr	font;
+	word		c;
+	byte		len;
+	word		fg, bg;
+	word		stamp;
+	byte		runs[GLYPHCACHE_SLOT_SIZE];
+} glyph_slot_type;
+
+class UTFT_GlyphCache
+{
+	public:
+		UTFT_GlyphCache(UTFT *ptrUTFT);
+
+		void			print(const char *st, int x, int y);
+		void			printChar(word c, int x, int y);
+		void			clearCache();
+		unsigned long	getHits();
+		unsigned long	getMisses();
+		void			resetStats();
+
+	protected:
+		UTFT			*_UTFT;
+		glyph_slot_type	slots[GLYPHCACHE_SLOTS];
+		word			_tick;
+		byte			_orient;
+		unsigned long	_hits, _misses;
+
+		int		_findSlot(word c, word fg, word bg);
+		int		_decodeGlyph(word c, word fg, word bg);
+		void	_drawSlot(int slot, int x, int y);
+};
+
+#endif
@@ -0,0 +1,121 @@
+/*
+  UTFT_Multi.cpp - Add-on Library for UTFT: Multiple Panels
+
+  This library runs several display modules on one shared data bus. The
+  modules share RS, WR and the data lines and each has its own CS line,
+  so every module has its own UTFT instance that can be drawn on as
+  usual for content that differs between them.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the CC BY-NC-SA 3.0 license.
+  Please see the included documents for further information.
+*/
+
+#include "UTFT_Multi.h"
+#include <UTFT.h>
+
+UTFT_Multi::UTFT_Multi()
+{
+	_count		= 0;
+	_mirroring	= false;
+}
+
+// The first module added drives the bus for InitLCD() and mirrored
+// drawing.
+int UTFT_Multi::addPanel(UTFT *ptrUTFT)
+{
+	if (_count>=MULTI_MAX_PANELS)
+		return -1;
+	_panels[_count] = ptrUTFT;
+	return _count++;
+}
+
+UTFT *UTFT_Multi::getPanel(int id)
+{
+	if ((id>=0) and (id<_count))
+		return _panels[id];
+	return NULL;
+}
+
+byte UTFT_Multi::getPanelCount()
+{
+	return _count;
+}
+
+// Holds the CS line of every module but the first one low, or releases
+// them. The first module still drives its own CS line.
+void UTFT_Multi::_select_others(boolean selected)
+{
+	for (byte i=1; i<_count; i++)
+		if (selected)
+			cbi(_panels[i]->P_CS, _panels[i]->B_CS);
+		else
+			sbi(_panels[i]->P_CS, _panels[i]->B_CS);
+}
+
+// Resets every module and sends them the init sequence once, together.
+// Modules may share the first module's RST line or have their own.
+void UTFT_Multi::InitLCD(byte orientation)
+{
+	UTFT	*first;
+
+	if (_count==0)
+		return;
+	first = _panels[0];
+
+	for (byte i=1; i<_count; i++)
+	{
+		_panels[i]->_hw_special_init();
+		pinMode(_panels[i]->__p3, OUTPUT);
+		sbi(_panels[i]->P_CS, _panels[i]->B_CS);
+		if ((_panels[i]->__p4!=NOTINUSE) and (_panels[i]->__p4!=first->__p4))
+		{
+			pinMode(_panels[i]->__p4, OUTPUT);
+			cbi(_panels[i]->P_RST, _panels[i]->B_RST);
+			delay(1);
+			sbi(_panels[i]->P_RST, _panels[i]->B_RST);
+		}
+	}
+
+	_select_others(true);
+	first->InitLCD(orientation);
+	_select_others(false);
+
+	for (byte i=1; i<_count; i++)
+	{
+		_panels[i]->orient = first->orient;
+		_panels[i]->_rotation = first->_rotation;
+		_panels[i]->disp_x_size = first->disp_x_size;
+		_panels[i]->disp_y_size = first->disp_y_size;
+		_panels[i]->setColor(255, 255, 255);
+		_panels[i]->setBackColor(0, 0, 0);
+		_panels[i]->_transparent = false;
+		_panels[i]->_win_valid = false;
+		_panels[i]->_ready = first->_ready;
+	}
+}
+
+// Returns the UTFT instance to draw on until endMirror(). What is drawn
+// on it goes to every module at once. The other instances must not be
+// drawn on in between.
+UTFT *UTFT_Multi::beginMirror()
+{
+	if (_count==0)
+		return NULL;
+	_mirroring = true;
+	// The modules may have been left with different address windows
+	_panels[0]->_win_valid = false;
+	_select_others(true);
+	return _panels[0];
+}
+
+void UTFT_Multi::endMirror()
+{
+	if (!_mirroring)
+		return;
+	_select_others(false);
+	// The other modules' address windows were changed behind their backs
+	for (byte i=1; i<_count; i++)
+		_panels[i]->_win_valid = false;
+	_mirroring = false;
+}
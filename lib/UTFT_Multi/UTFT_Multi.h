@@ -0,0 +1,61 @@
+/*
+  UTFT_Multi.h - Add-on Library for UTFT: Multiple Panels
+
+  This library runs several display modules on one shared data bus. The
+  modules share RS, WR and the data lines and each has its own CS line,
+  so every module has its own UTFT instance that can be drawn on as
+  usual for content that differs between them.
+
+  Content that is the same on all modules can be drawn once while every
+  CS line is held low, which sends it to all modules in a single bus
+  pass instead of once per module.
+
+  All modules must be the same model and be used in the same
+  orientation.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the CC BY-NC-SA 3.0 license.
+  Please see the included documents for further information.
+*/
+
+#ifndef UTFT_Multi_h
+#define UTFT_Multi_h
+
+#if defined(__AVR__)
+	#include "Arduino.h"
+#elif defined(__PIC32MX__)
+	#include "WProgram.h"
+#elif defined(__arm__)
+	#include "Arduino.h"
+#endif
+
+#include <UTFT.h>
+#if ((!defined(UTFT_VERSION)) || (UTFT_VERSION<279))
+	#error : You will need UTFT v2.79 or higher to use this add-on library...
+#endif
+
+#ifndef MULTI_MAX_PANELS
+	#define MULTI_MAX_PANELS	4	// Number of modules that can be added
+#endif
+
+class UTFT_Multi
+{
+	public:
+		UTFT_Multi();
+
+		int		addPanel(UTFT *ptrUTFT);
+		UTFT	*getPanel(int id);
+		byte	getPanelCount();
+		void	InitLCD(byte orientation=LANDSCAPE);
+		UTFT	*beginMirror();
+		void	endMirror();
+
+	protected:
+		UTFT	*_panels[MULTI_MAX_PANELS];
+		byte	_count;
+		boolean	_mirroring;
+
+		void	_select_others(boolean selected);
+};
+
+#endif
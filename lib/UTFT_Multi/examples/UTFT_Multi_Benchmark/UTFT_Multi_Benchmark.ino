@@ -0,0 +1,90 @@
+// UTFT_Multi_Benchmark
+//
+// This program shows how to run two display modules on one data bus,
+// with the same content on both and some content that differs, and
+// measures drawing the same frame once for both modules against drawing
+// it on each module in turn. The results are shown on the displays and
+// sent to the serial monitor at 9600 baud.
+//
+// Both modules share RS (38), WR (39) and the data lines. The first
+// module has CS on 40 and RST on 41, the second CS on 42 and RST on 43.
+//
+// This demo was made to work on the 480x320 modules.
+// Any other size displays may cause strange behaviour.
+//
+// This program requires the UTFT library and the UTFT_Multi add-on.
+//
+
+#include <UTFT.h>
+#include <UTFT_Multi.h>
+
+// Declare which fonts we will be using
+extern uint8_t BigFont[];
+
+// Remember to change the model parameter to suit your display modules!
+UTFT panelA(ILI9486,38,39,40,41);
+UTFT panelB(ILI9486,38,39,42,43);
+UTFT_Multi panels;
+
+void frame(UTFT *g)
+{
+  g->setColor(VGA_RED);
+  g->fillRect(230, 0, 245, 305);
+  g->setColor(VGA_BLUE);
+  g->fillRect(245, 0, 260, 305);
+  g->setColor(VGA_WHITE);
+  g->print("GAME TIMER:", 120, 305);
+}
+
+void show(int y, const char *label, unsigned long us)
+{
+  UTFT *all=panels.beginMirror();
+  all->print(label, 10, y);
+  all->printNumI(us, 250, y, 7);
+  all->print("us", 370, y);
+  panels.endMirror();
+  Serial.print(label);
+  Serial.print(": ");
+  Serial.print(us);
+  Serial.println(" us");
+}
+
+void setup()
+{
+  Serial.begin(9600);
+  panels.addPanel(&panelA);
+  panels.addPanel(&panelB);
+  panels.InitLCD();
+  panelA.setFont(BigFont);
+  panelB.setFont(BigFont);
+}
+
+void loop()
+{
+  unsigned long start, mirrored, twice;
+  UTFT *all;
+
+  all=panels.beginMirror();
+  all->clrScr();
+  panels.endMirror();
+
+  start=micros();
+  all=panels.beginMirror();
+  frame(all);
+  panels.endMirror();
+  mirrored=micros()-start;
+
+  start=micros();
+  frame(&panelA);
+  frame(&panelB);
+  twice=micros()-start;
+
+  // Each module also gets its own content
+  panelA.print("RED", 50, 100);
+  panelB.print("BLUE", 50, 100);
+
+  show(150, "Mirrored", mirrored);
+  show(170, "Drawn twice", twice);
+
+  delay(10000);
+}
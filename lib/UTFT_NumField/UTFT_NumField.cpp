@@ -0,0 +1,155 @@
+/*
+  UTFT_NumField.cpp - Add-on Library for UTFT: Numeric Fields
+
+  This library adds numeric fields, such as score counters, that are
+  bound to a position and font on the display. When the value is
+  changed only the character cells whose digit is different from what
+  is already on screen are redrawn. Cells that are no longer used when
+  the number gets shorter are cleared with the background color.
+  A value with more digits than the field has cells is clamped to the
+  nearest value that fits.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the CC BY-NC-SA 3.0 license.
+  Please see the included documents for further information.
+*/
+
+#include "UTFT_NumField.h"
+#include <UTFT.h>
+
+UTFT_NumField::UTFT_NumField(UTFT *ptrUTFT, int x, int y, uint8_t *font, byte width, byte scale)
+{
+	_UTFT	= ptrUTFT;
+	_x		= x;
+	_y		= y;
+	_font	= font;
+	_width	= width;
+	if (_width>NUMFIELD_MAX_CELLS)
+		_width = NUMFIELD_MAX_CELLS;
+	_scale	= scale;
+	if (_scale<1)
+		_scale = 1;
+	_len	= 0;
+	_value	= 0;
+	_fg		= 0;
+	_bg		= 0;
+	_valid	= false;
+	_last_cells  = 0;
+	_last_estimate = 0;
+}
+
+long UTFT_NumField::get()
+{
+	return _value;
+}
+
+// Forces every cell to be drawn on the next call to set(), e.g. after the
+// screen has been cleared.
+void UTFT_NumField::redraw()
+{
+	_valid = false;
+	set(_value);
+}
+
+word UTFT_NumField::getLastCells()
+{
+	return _last_cells;
+}
+
+// Pixels in the cells the last set() redrew or cleared. That is what was
+// sent with an opaque background, not counting the address windows. With
+// a transparent background only the foreground of a redrawn cell is sent,
+// so the real number is lower.
+unsigned long UTFT_NumField::getLastPixelEstimate()
+{
+	return _last_estimate;
+}
+
+// Values that do not fit are clamped to the nearest one that does, so
+// 1234 in three cells is shown as 999 and -123 as -99.
+byte UTFT_NumField::_format(long value, char *buf)
+{
+	unsigned long	num = value;
+	unsigned long	div = 1;
+	byte			len = 0;
+	byte			digits = 1;
+
+	if (value<0)
+	{
+		if (_width<2)
+		{
+			buf[len++] = '0';
+			return len;
+		}
+		buf[len++] = '-';
+		num = 0UL-num;
+	}
+	while ((num/div)>=10)
+	{
+		div*=10;
+		digits++;
+	}
+	if (len+digits>_width)
+	{
+		while (len<_width)
+			buf[len++] = '9';
+		return len;
+	}
+	while (div>0)
+	{
+		buf[len++] = 48+((num/div) % 10);
+		div/=10;
+	}
+	return len;
+}
+
+void UTFT_NumField::set(long value)
+{
+	UTFT_PROFILE_SCOPE(_UTFT, PROFILE_NUMFIELD);
+	assetptr _font_current = _UTFT->getFontAddress();
+	word	_current_color = _UTFT->getColor();
+	word	_current_back  = _UTFT->getBackColor();
+	char	buf[NUMFIELD_MAX_CELLS];
+	byte	len;
+	word	xs, ys;
+
+	_value = value;
+	if (!_UTFT->ready())
+		return;
+	len = _format(value, buf);
+
+	if ((_current_color!=_fg) or (_current_back!=_bg))
+		_valid = false;
+
+	_UTFT->setFont(_font);
+	xs = _UTFT->getFontXsize()*_scale;
+	ys = _UTFT->getFontYsize()*_scale;
+	_last_cells = 0;
+
+	for (byte i=0; i<len; i++)
+		if ((!_valid) or (i>=_len) or (buf[i]!=_shown[i]))
+		{
+			if (_scale==1)
+				_UTFT->printChar(buf[i], _x+(i*xs), _y);
+			else
+				_UTFT->printCharScaled(buf[i], _x+(i*xs), _y, _scale);
+			_shown[i] = buf[i];
+			_last_cells++;
+		}
+
+	if (len<_len)
+	{
+		_UTFT->setColor(_current_back);
+		_UTFT->fillRect(_x+(len*xs), _y, _x+(_len*xs)-1, _y+ys-1);
+		_UTFT->setColor(_current_color);
+		_last_cells += _len-len;
+	}
+
+	_last_estimate = long(_last_cells)*xs*ys;
+	_len	= len;
+	_fg		= _current_color;
+	_bg		= _current_back;
+	_valid	= true;
+	if (_font_current!=0)
+		_UTFT->setFont(_font_current);
+}
@@ -0,0 +1,64 @@
+/*
+  UTFT_NumField.h - Add-on Library for UTFT: Numeric Fields
+
+  This library adds numeric fields, such as score counters, that are
+  bound to a position and font on the display. When the value is
+  changed only the character cells whose digit is different from what
+  is already on screen are redrawn. Cells that are no longer used when
+  the number gets shorter are cleared with the background color.
+  A value with more digits than the field has cells is clamped to the
+  nearest value that fits.
+
+  A field can draw a small font enlarged by an integer scale factor
+  instead of needing a large font in flash.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the CC BY-NC-SA 3.0 license.
+  Please see the included documents for further information.
+*/
+
+#ifndef UTFT_NumField_h
+#define UTFT_NumField_h
+
+#if defined(__AVR__)
+	#include "Arduino.h"
+#elif defined(__PIC32MX__)
+	#include "WProgram.h"
+#elif defined(__arm__)
+	#include "Arduino.h"
+#endif
+
+#include <UTFT.h>
+#if ((!defined(UTFT_VERSION)) || (UTFT_VERSION<279))
+	#error : You will need UTFT v2.79 or higher to use this add-on library...
+#endif
+
+#define NUMFIELD_MAX_CELLS	11	// Enough for "-2147483648"
+
+class UTFT_NumField
+{
+	public:
+		UTFT_NumField(UTFT *ptrUTFT, int x, int y, uint8_t *font, byte width, byte scale=1);
+
+		void			set(long value);
+		long			get();
+		void			redraw();
+		word			getLastCells();
+		unsigned long	getLastPixelEstimate();
+
+	protected:
+		UTFT			*_UTFT;
+		int				_x, _y;
+		uint8_t			*_font;
+		byte			_width, _len, _scale;
+		char			_shown[NUMFIELD_MAX_CELLS];
+		word			_fg, _bg;
+		boolean			_valid;
+		long			_value;
+		word			_last_cells;
+		unsigned long	_last_estimate;
+
+		byte	_format(long value, char *buf);
+};
+
+#endif
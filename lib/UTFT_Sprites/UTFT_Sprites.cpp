@@ -0,0 +1,319 @@
+/*
+  UTFT_Sprites.cpp - Add-on Library for UTFT: Sprites
+
+  This library moves small bitmaps around on the display without the
+  flicker of erasing them with fillRect() and drawing them again. Moves
+  are collected until update() is called, which then restores only the
+  parts of the old positions that are no longer covered and redraws the
+  sprites that need it, in the order they were added.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the CC BY-NC-SA 3.0 license.
+  Please see the included documents for further information.
+*/
+
+#include "UTFT_Sprites.h"
+#include <UTFT.h>
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#endif
+
+UTFT_Sprites::UTFT_Sprites(UTFT *ptrUTFT)
+{
+	_UTFT		= ptrUTFT;
+	_bg			= VGA_BLACK;
+	_restore	= NULL;
+	_last_rects  = 0;
+	_last_pixels = 0;
+	deleteAllSprites();
+}
+
+int UTFT_Sprites::addSprite(bitmapdatatype data, int sx, int sy, uint32_t key)
+{
+	for (int i=0; i<SPRITES_MAX; i++)
+		if (sprites[i].flags==0)
+		{
+			sprites[i].data  = data;
+			sprites[i].sx    = sx;
+			sprites[i].sy    = sy;
+			sprites[i].x     = 0;
+			sprites[i].y     = 0;
+			sprites[i].key   = key;
+			sprites[i].flags = SPRITE_USED;
+			return i;
+		}
+	return -1;
+}
+
+// The sprite is taken off the screen by the next update(), which also
+// frees its slot.
+void UTFT_Sprites::deleteSprite(int id)
+{
+	if ((id>=0) and (id<SPRITES_MAX) and (sprites[id].flags & SPRITE_USED))
+	{
+		hide(id);
+		sprites[id].flags &= ~SPRITE_USED;
+	}
+}
+
+// Forgets all sprites without touching the screen, e.g. after clrScr().
+void UTFT_Sprites::deleteAllSprites()
+{
+	for (int i=0; i<SPRITES_MAX; i++)
+		sprites[i].flags = 0;
+}
+
+void UTFT_Sprites::setImage(int id, bitmapdatatype data, int sx, int sy)
+{
+	if ((id>=0) and (id<SPRITES_MAX) and (sprites[id].flags & SPRITE_USED))
+	{
+		sprites[id].data = data;
+		sprites[id].sx   = sx;
+		sprites[id].sy   = sy;
+		sprites[id].flags |= SPRITE_CHANGED;
+	}
+}
+
+void UTFT_Sprites::moveTo(int id, int x, int y)
+{
+	if ((id>=0) and (id<SPRITES_MAX) and (sprites[id].flags & SPRITE_USED) and ((sprites[id].x!=x) or (sprites[id].y!=y)))
+	{
+		sprites[id].x = x;
+		sprites[id].y = y;
+		sprites[id].flags |= SPRITE_CHANGED;
+	}
+}
+
+void UTFT_Sprites::show(int id)
+{
+	if ((id>=0) and (id<SPRITES_MAX) and (sprites[id].flags & SPRITE_USED) and !(sprites[id].flags & SPRITE_VISIBLE))
+		sprites[id].flags |= SPRITE_VISIBLE | SPRITE_CHANGED;
+}
+
+void UTFT_Sprites::hide(int id)
+{
+	if ((id>=0) and (id<SPRITES_MAX) and (sprites[id].flags & SPRITE_VISIBLE))
+	{
+		sprites[id].flags &= ~SPRITE_VISIBLE;
+		sprites[id].flags |= SPRITE_CHANGED;
+	}
+}
+
+boolean UTFT_Sprites::isVisible(int id)
+{
+	if ((id>=0) and (id<SPRITES_MAX))
+		return (sprites[id].flags & SPRITE_VISIBLE)!=0;
+	return false;
+}
+
+void UTFT_Sprites::setBackground(word color)
+{
+	_bg			= color;
+	_restore	= NULL;
+}
+
+// restore() is called with a rectangle, already clipped to the display,
+// that must be redrawn with whatever is behind the sprites.
+void UTFT_Sprites::setBackground(void (*restore)(int x1, int y1, int x2, int y2))
+{
+	_restore = restore;
+}
+
+word UTFT_Sprites::getLastRects()
+{
+	return _last_rects;
+}
+
+unsigned long UTFT_Sprites::getLastPixels()
+{
+	return _last_pixels;
+}
+
+static boolean _overlaps(sprite_rect_type *a, sprite_rect_type *b)
+{
+	return (a->x1<=b->x2) and (b->x1<=a->x2) and (a->y1<=b->y2) and (b->y1<=a->y2);
+}
+
+boolean UTFT_Sprites::_clip(sprite_rect_type *r)
+{
+	if (r->x1<0)
+		r->x1 = 0;
+	if (r->y1<0)
+		r->y1 = 0;
+	if (r->x2>=_UTFT->getDisplayXSize())
+		r->x2 = _UTFT->getDisplayXSize()-1;
+	if (r->y2>=_UTFT->getDisplayYSize())
+		r->y2 = _UTFT->getDisplayYSize()-1;
+	return (r->x1<=r->x2) and (r->y1<=r->y2);
+}
+
+void UTFT_Sprites::_restoreRect(sprite_rect_type *r)
+{
+	word	_current_color;
+
+	if (!_clip(r))
+		return;
+	if (_restore!=NULL)
+		_restore(r->x1, r->y1, r->x2, r->y2);
+	else
+	{
+		_current_color = _UTFT->getColor();
+		_UTFT->setColor(_bg);
+		_UTFT->fillRect(r->x1, r->y1, r->x2, r->y2);
+		_UTFT->setColor(_current_color);
+	}
+	_last_rects++;
+	_last_pixels += long(r->x2-r->x1+1)*(r->y2-r->y1+1);
+}
+
+// Sends each row as runs of pixels that are not the key color, every run
+// through its own window. Without a key color the whole clipped sprite is
+// one window in PORTRAIT, or one per row in LANDSCAPE.
+void UTFT_Sprites::_drawSprite(sprite_type *s)
+{
+	sprite_rect_type	r;
+	int		tx, ty, start;
+	boolean	keyed = (s->key!=VGA_TRANSPARENT);
+
+	r.x1 = s->x;
+	r.y1 = s->y;
+	r.x2 = s->x+s->sx-1;
+	r.y2 = s->y+s->sy-1;
+	if (!_clip(&r))
+		return;
+
+	cbi(_UTFT->P_CS, _UTFT->B_CS);
+	if ((!keyed) and (_UTFT->orient==PORTRAIT))
+		_UTFT->setXY(r.x1, r.y1, r.x2, r.y2);
+	for (ty=r.y1; ty<=r.y2; ty++)
+	{
+		bitmapdatatype row = &s->data[long(ty-s->y)*s->sx];
+		tx = r.x1;
+		while (tx<=r.x2)
+		{
+			if (keyed)
+				while ((tx<=r.x2) and (pgm_read_word(&row[tx-s->x])==s->key))
+					tx++;
+			start = tx;
+			if (keyed)
+				while ((tx<=r.x2) and (pgm_read_word(&row[tx-s->x])!=s->key))
+					tx++;
+			else
+				tx = r.x2+1;
+			if (start==tx)
+				continue;
+
+			if ((keyed) or (_UTFT->orient!=PORTRAIT))
+				_UTFT->setXY(start, ty, tx-1, ty);
+			_UTFT->_write_bitmap_run(&row[start-s->x], tx-start, _UTFT->orient!=PORTRAIT);
+			_last_pixels += tx-start;
+		}
+	}
+	sbi(_UTFT->P_CS, _UTFT->B_CS);
+	_UTFT->clrXY();
+}
+
+// Restores the uncovered parts of every changed sprite's old rectangle,
+// then redraws in order every visible sprite that changed, lies on a
+// restored area or overlaps a sprite drawn before it. A keyed sprite
+// shows what is behind it, so its whole old rectangle is restored.
+void UTFT_Sprites::update()
+{
+	if (!_UTFT->ready())
+		return;
+	UTFT_PROFILE_SCOPE(_UTFT, PROFILE_SPRITES);
+	// Up to four strips per sprite, too many for the stack. update() is not
+	// reentrant, so all instances can share them.
+	static sprite_rect_type	dirty[SPRITES_MAX*4];
+	sprite_rect_type	o, n, t;
+	boolean	redraw[SPRITES_MAX];
+	byte	nd = 0;
+	sprite_type	*s;
+
+	_last_rects  = 0;
+	_last_pixels = 0;
+
+	for (int i=0; i<SPRITES_MAX; i++)
+	{
+		s = &sprites[i];
+		redraw[i] = (s->flags & SPRITE_CHANGED) and (s->flags & SPRITE_VISIBLE);
+		if (!(s->flags & SPRITE_CHANGED) or !(s->flags & SPRITE_SHOWN))
+			continue;
+
+		o.x1 = s->ox;
+		o.y1 = s->oy;
+		o.x2 = s->ox+s->osx-1;
+		o.y2 = s->oy+s->osy-1;
+		n.x1 = s->x;
+		n.y1 = s->y;
+		n.x2 = s->x+s->sx-1;
+		n.y2 = s->y+s->sy-1;
+		if (!(s->flags & SPRITE_VISIBLE) or (s->key!=VGA_TRANSPARENT) or !_overlaps(&o, &n))
+			dirty[nd++] = o;
+		else
+		{
+			// The old rectangle minus the new one, as up to four strips
+			if (o.y1<n.y1)
+			{
+				dirty[nd] = o;
+				dirty[nd++].y2 = n.y1-1;
+				o.y1 = n.y1;
+			}
+			if (o.y2>n.y2)
+			{
+				dirty[nd] = o;
+				dirty[nd++].y1 = n.y2+1;
+				o.y2 = n.y2;
+			}
+			if (o.x1<n.x1)
+			{
+				dirty[nd] = o;
+				dirty[nd++].x2 = n.x1-1;
+			}
+			if (o.x2>n.x2)
+			{
+				dirty[nd] = o;
+				dirty[nd++].x1 = n.x2+1;
+			}
+		}
+		s->flags &= ~SPRITE_SHOWN;
+	}
+	for (byte d=0; d<nd; d++)
+	{
+		t = dirty[d];
+		_restoreRect(&t);
+	}
+
+	for (int i=0; i<SPRITES_MAX; i++)
+	{
+		s = &sprites[i];
+		s->flags &= ~SPRITE_CHANGED;
+		if (!(s->flags & SPRITE_VISIBLE))
+			continue;
+
+		n.x1 = s->x;
+		n.y1 = s->y;
+		n.x2 = s->x+s->sx-1;
+		n.y2 = s->y+s->sy-1;
+		for (byte d=0; (d<nd) and !redraw[i]; d++)
+			redraw[i] = _overlaps(&n, &dirty[d]);
+		for (int j=0; (j<i) and !redraw[i]; j++)
+			if (redraw[j])
+			{
+				t.x1 = sprites[j].x;
+				t.y1 = sprites[j].y;
+				t.x2 = sprites[j].x+sprites[j].sx-1;
+				t.y2 = sprites[j].y+sprites[j].sy-1;
+				redraw[i] = _overlaps(&n, &t);
+			}
+		if (!redraw[i])
+			continue;
+
+		_drawSprite(s);
+		s->ox  = s->x;
+		s->oy  = s->y;
+		s->osx = s->sx;
+		s->osy = s->sy;
+		s->flags |= SPRITE_SHOWN;
+	}
+}
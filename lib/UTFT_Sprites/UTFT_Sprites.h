@@ -0,0 +1,93 @@
+/*
+  UTFT_Sprites.h - Add-on Library for UTFT: Sprites
+
+  This library moves small bitmaps around on the display without the
+  flicker of erasing them with fillRect() and drawing them again. Moves
+  are collected until update() is called, which then restores only the
+  parts of the old positions that are no longer covered and redraws the
+  sprites that need it, in the order they were added.
+
+  Sprites can have a key color. Pixels in that color are not drawn, so
+  whatever is behind the sprite shows through.
+
+  Uncovered areas are filled with a background color, or handed to a
+  function in the sketch that can redraw what was behind the sprite.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the CC BY-NC-SA 3.0 license.
+  Please see the included documents for further information.
+*/
+
+#ifndef UTFT_Sprites_h
+#define UTFT_Sprites_h
+
+#if defined(__AVR__)
+	#include "Arduino.h"
+#elif defined(__PIC32MX__)
+	#include "WProgram.h"
+#elif defined(__arm__)
+	#include "Arduino.h"
+#endif
+
+#include <UTFT.h>
+#if ((!defined(UTFT_VERSION)) || (UTFT_VERSION<279))
+	#error : You will need UTFT v2.79 or higher to use this add-on library...
+#endif
+
+#ifndef SPRITES_MAX
+	#define SPRITES_MAX		8	// Number of sprites that can be added
+#endif
+
+#define SPRITE_USED		0x01
+#define SPRITE_VISIBLE	0x02	// Should be on screen after the next update()
+#define SPRITE_SHOWN	0x04	// Is on screen at ox, oy
+#define SPRITE_CHANGED	0x08	// Moved, shown, hidden or given a new image
+
+typedef struct
+{
+	int		x1, y1, x2, y2;
+} sprite_rect_type;
+
+typedef struct
+{
+	bitmapdatatype	data;
+	int				sx, sy;
+	int				x, y;
+	int				ox, oy, osx, osy;
+	uint32_t		key;
+	byte			flags;
+} sprite_type;
+
+class UTFT_Sprites
+{
+	public:
+		UTFT_Sprites(UTFT *ptrUTFT);
+
+		int		addSprite(bitmapdatatype data, int sx, int sy, uint32_t key=VGA_TRANSPARENT);
+		void	deleteSprite(int id);
+		void	deleteAllSprites();
+		void	setImage(int id, bitmapdatatype data, int sx, int sy);
+		void	moveTo(int id, int x, int y);
+		void	show(int id);
+		void	hide(int id);
+		boolean	isVisible(int id);
+		void	setBackground(word color);
+		void	setBackground(void (*restore)(int x1, int y1, int x2, int y2));
+		void	update();
+		word	getLastRects();
+		unsigned long	getLastPixels();
+
+	protected:
+		UTFT			*_UTFT;
+		sprite_type		sprites[SPRITES_MAX];
+		word			_bg;
+		void			(*_restore)(int x1, int y1, int x2, int y2);
+		word			_last_rects;
+		unsigned long	_last_pixels;
+
+		boolean	_clip(sprite_rect_type *r);
+		void	_restoreRect(sprite_rect_type *r);
+		void	_drawSprite(sprite_type *s);
+};
+
+#endif
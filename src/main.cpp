@@ -9,9 +9,12 @@
 
 #include <Arduino.h>
 #include <UTFT.h>
+#include <UTFT_GlyphCache.h>
+#include <UTFT_NumField.h>
 
 static void teamAction(int team);
 static void debugGame();
+static void displayStart();
 static void displayUpdate();
 
 // Set button values to hardware pinouts
@@ -27,12 +30,23 @@ unsigned long currentTime;
 // Team Delay vars, used to mark when the buttons have been pressed during time
 unsigned long redTeamLastPressTime = 0, blueTeamLastPressTime = 0;
 
+// Set once the screen has finished starting up and has been cleared
+bool displayStarted = false;
+
 // Set font values for TFT screen
 extern uint8_t BigFont[];
 extern uint8_t SevenSeg_XXXL_Num[];
 
 // Set TFT screen display
-UTFT myGLCD(ILI9486, 38, 39, 40, 41);
+UTFT_Panel<ILI9486> myGLCD(38, 39, 40, 41);
+
+// Keeps decoded BigFont characters in RAM, as the labels are redrawn every pass
+UTFT_GlyphCache myGlyphs(&myGLCD);
+
+// Score counters, only the digits that change are redrawn. The font is 64
+// pixels wide, so two cells fit between the edges and the center bars.
+UTFT_NumField redScore(&myGLCD, 60, 80, SevenSeg_XXXL_Num, 2);
+UTFT_NumField blueScore(&myGLCD, 310, 80, SevenSeg_XXXL_Num, 2);
 
 /**
  * @brief Arduino setup for game input
@@ -45,17 +59,15 @@ void setup()
   // Sets baud rate to communicate to computer for any messages, used for debug
   Serial.begin(9600);
 
-  // Start up TFT screen
-  myGLCD.InitLCD();
-  myGLCD.clrScr();
-  myGLCD.setFont(BigFont);
-  myGLCD.fillScr(VGA_WHITE);
-  myGLCD.setBackColor(VGA_BLACK);
-
   // Set button modes
   pinMode(redButton, INPUT);
   pinMode(blueButton, INPUT);
 
+  // Start up TFT screen, it finishes in loop() so scoring works from power-on
+  myGLCD.beginInitLCD();
+  myGLCD.setFont(BigFont);
+  myGLCD.setBackColor(VGA_BLACK);
+
   Serial.println("[INFO] Started!");
 }
 
@@ -84,7 +96,44 @@ void loop()
     teamAction(blueButton);
   }
 
+  // Nothing is drawn until the screen has started up
+  if (!myGLCD.updateInitLCD())
+  {
+    return;
+  }
+  if (!displayStarted)
+  {
+    displayStart();
+  }
+
+#if defined(UTFT_PROFILE)
+  // Counts what one pass of displayUpdate() sends to the display
+  myGLCD.resetProfile();
+#endif
   displayUpdate();
+#if defined(UTFT_PROFILE)
+  static unsigned int profiledPasses = 0;
+  if (++profiledPasses % 100 == 0)
+  {
+    Serial.println("[PROFILE] displayUpdate():");
+    myGLCD.printProfile(Serial);
+  }
+#endif
+}
+
+/**
+ * @brief Clears the display
+ * 
+ * Runs once, on the first pass after the screen has finished starting up.
+ * 
+ */
+void displayStart()
+{
+  myGLCD.clrScr();
+  myGLCD.fillScr(VGA_WHITE);
+  displayStarted = true;
+  Serial.println("[INFO] Display ready!");
+  return;
 }
 
 /**
@@ -102,14 +151,15 @@ void displayUpdate()
   myGLCD.setColor(VGA_BLUE);
   myGLCD.fillRect(245, 0, 260, 305);
   myGLCD.setColor(VGA_WHITE);
-  myGLCD.print("RED TEAM:", 50, 25);
-  myGLCD.print("BLUE TEAM:", 280, 25);
-  myGLCD.setFont(SevenSeg_XXXL_Num);
-  myGLCD.print(String(redTeamCount), 60, 80);
-  myGLCD.print(String(blueTeamCount), 310, 80);
-  myGLCD.setFont(BigFont);
-
-  myGLCD.print("GAME TIMER: " + String(currentTime) + "ms", 120, 305);
+  myGlyphs.print("RED TEAM:", 50, 25);
+  myGlyphs.print("BLUE TEAM:", 280, 25);
+  redScore.set(redTeamCount);
+  blueScore.set(blueTeamCount);
+
+  // Timer is padded to a fixed width so the unit stays in place
+  myGLCD.print(F("GAME TIMER: "), 120, 305);
+  myGLCD.printNumI(currentTime, 312, 305, 7);
+  myGLCD.print(F("ms"), 424, 305);
   return;
 }
 
@@ -0,0 +1,106 @@
+// Arduino core for the host build, with only what UTFT and its add-ons
+// use. Pins are numbered as on the Mega and every pin has an output
+// register of its own, a HostReg, that reports each change to the
+// simulated displays in UTFT_Host.cpp. Time only passes in delay().
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+// Before UTFT defines its swap() macro
+#include <string>
+#include <vector>
+
+#include <avr/pgmspace.h>
+#include <avr/io.h>
+
+#define ARDUINO		10805
+
+#define HIGH		1
+#define LOW			0
+#define INPUT		0
+#define OUTPUT		1
+#define INPUT_PULLUP	2
+
+typedef uint8_t		byte;
+typedef uint16_t	word;
+typedef bool		boolean;
+
+// Output register of one pin, used by UTFT through regtype
+class HostReg
+{
+	public:
+		HostReg &operator=(uint8_t value);
+		HostReg &operator|=(uint8_t value);
+		HostReg &operator&=(uint8_t value);
+		operator uint8_t() const;
+
+		uint8_t	value;
+};
+#define regtype		HostReg
+
+extern HostReg	host_pins[];
+
+#include "pins_arduino.h"
+
+void			pinMode(uint8_t pin, uint8_t mode);
+void			digitalWrite(uint8_t pin, uint8_t val);
+int				digitalRead(uint8_t pin);
+unsigned long	millis();
+unsigned long	micros();
+void			delay(unsigned long ms);
+void			delayMicroseconds(unsigned int us);
+char			*dtostrf(double val, signed char width, unsigned char prec, char *buf);
+
+class __FlashStringHelper;
+#define F(s)		(reinterpret_cast<const __FlashStringHelper *>(s))
+
+class String
+{
+	public:
+		String(const char *cstr="");
+		String(const String &str);
+		~String();
+		String &operator=(const String &str);
+		const char *c_str() const;
+		unsigned int length() const;
+
+	private:
+		char	*_buf;
+};
+
+class Print
+{
+	public:
+		virtual ~Print() {}
+		virtual size_t write(uint8_t c) = 0;
+		size_t	write(const char *str);
+		size_t	print(const __FlashStringHelper *str);
+		size_t	print(const char *str);
+		size_t	print(char c);
+		size_t	print(int n);
+		size_t	print(unsigned int n);
+		size_t	print(long n);
+		size_t	print(unsigned long n);
+		size_t	println();
+		size_t	println(const __FlashStringHelper *str);
+		size_t	println(const char *str);
+		size_t	println(long n);
+		size_t	println(unsigned long n);
+};
+
+class HardwareSerial : public Print
+{
+	public:
+		void	begin(unsigned long baud);
+		size_t	write(uint8_t c);
+		using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,531 @@
+/*
+  UTFT_Host.cpp - Arduino Mega simulation for the host build
+
+  See UTFT_Host.h.
+*/
+
+#include "UTFT_Host.h"
+#include <new>
+
+HostReg			host_pins[NUM_DIGITAL_PINS];
+HardwareSerial	Serial;
+
+volatile uint8_t	PORTA, PORTB, PORTC, PORTD, PORTE, PORTF, PORTG, PORTH;
+volatile uint8_t	DDRA, DDRB, DDRC, DDRD, DDRE, DDRF, DDRG, DDRH;
+volatile uint8_t	SPCR;
+HostSPSR			SPSR;
+HostSPDR			SPDR;
+
+unsigned long	host_heap_allocs = 0;
+
+static HostPanel		*_panels[HOST_PANELS];
+static unsigned long	_now_us = 0;
+
+// *** Heap ***
+
+void *operator new(size_t size)
+{
+	void	*p;
+
+	host_heap_allocs++;
+	p = malloc(size ? size : 1);
+	if (p==NULL)
+		throw std::bad_alloc();
+	return p;
+}
+
+void *operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void *p) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+	free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void *p, size_t) noexcept
+{
+	free(p);
+}
+
+// *** Pins ***
+
+static void _pin_changed(byte pin, byte level)
+{
+	for (int i=0; i<HOST_PANELS; i++)
+		if (_panels[i]!=NULL)
+			_panels[i]->_pin(pin, level);
+}
+
+HostReg &HostReg::operator=(uint8_t v)
+{
+	byte	old = value;
+
+	value = v & 1;
+	if (value!=old)
+		_pin_changed(this-host_pins, value);
+	return *this;
+}
+
+HostReg &HostReg::operator|=(uint8_t v)
+{
+	return *this = value | v;
+}
+
+HostReg &HostReg::operator&=(uint8_t v)
+{
+	return *this = value & v;
+}
+
+HostReg::operator uint8_t() const
+{
+	return value;
+}
+
+void pinMode(uint8_t, uint8_t)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+	if (pin<NUM_DIGITAL_PINS)
+		host_pins[pin] = (val!=LOW);
+}
+
+int digitalRead(uint8_t pin)
+{
+	if (pin<NUM_DIGITAL_PINS)
+		return host_pins[pin].value;
+	return LOW;
+}
+
+// *** SPI ***
+
+HostSPDR &HostSPDR::operator=(uint8_t value)
+{
+	last = value;
+	if (SPCR & _BV(SPE))
+		for (int i=0; i<HOST_PANELS; i++)
+			if (_panels[i]!=NULL)
+				_panels[i]->_spi(value);
+	return *this;
+}
+
+HostSPDR::operator uint8_t() const
+{
+	return last;
+}
+
+HostSPSR &HostSPSR::operator=(uint8_t v)
+{
+	value = v;
+	return *this;
+}
+
+HostSPSR &HostSPSR::operator|=(uint8_t v)
+{
+	value |= v;
+	return *this;
+}
+
+HostSPSR &HostSPSR::operator&=(uint8_t v)
+{
+	value &= v;
+	return *this;
+}
+
+HostSPSR::operator uint8_t() const
+{
+	return value | _BV(SPIF);
+}
+
+// *** Time ***
+
+unsigned long millis()
+{
+	return _now_us/1000;
+}
+
+unsigned long micros()
+{
+	return _now_us;
+}
+
+void delay(unsigned long ms)
+{
+	_now_us += ms*1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+	_now_us += us;
+}
+
+void host_advance(unsigned long ms)
+{
+	delay(ms);
+}
+
+void host_reset()
+{
+	for (int i=0; i<NUM_DIGITAL_PINS; i++)
+		host_pins[i].value = LOW;
+	PORTA = PORTB = PORTC = PORTD = PORTE = PORTF = PORTG = PORTH = 0;
+	SPCR = 0;
+	SPSR = 0;
+	SPDR.last = 0;
+	_now_us = 0;
+}
+
+char *dtostrf(double val, signed char width, unsigned char prec, char *buf)
+{
+	sprintf(buf, "%*.*f", width, prec, val);
+	return buf;
+}
+
+// *** String and Print ***
+
+String::String(const char *cstr)
+{
+	_buf = new char[strlen(cstr)+1];
+	strcpy(_buf, cstr);
+}
+
+String::String(const String &str)
+{
+	_buf = new char[str.length()+1];
+	strcpy(_buf, str._buf);
+}
+
+String::~String()
+{
+	delete[] _buf;
+}
+
+String &String::operator=(const String &str)
+{
+	if (this!=&str)
+	{
+		delete[] _buf;
+		_buf = new char[str.length()+1];
+		strcpy(_buf, str._buf);
+	}
+	return *this;
+}
+
+const char *String::c_str() const
+{
+	return _buf;
+}
+
+unsigned int String::length() const
+{
+	return strlen(_buf);
+}
+
+size_t Print::write(const char *str)
+{
+	size_t	n = 0;
+
+	while (*str)
+		n += write((uint8_t)*str++);
+	return n;
+}
+
+size_t Print::print(const __FlashStringHelper *str)
+{
+	return write((const char *)str);
+}
+
+size_t Print::print(const char *str)
+{
+	return write(str);
+}
+
+size_t Print::print(char c)
+{
+	return write((uint8_t)c);
+}
+
+size_t Print::print(int n)
+{
+	return print(long(n));
+}
+
+size_t Print::print(unsigned int n)
+{
+	return print((unsigned long)n);
+}
+
+size_t Print::print(long n)
+{
+	char	buf[24];
+
+	sprintf(buf, "%ld", n);
+	return write(buf);
+}
+
+size_t Print::print(unsigned long n)
+{
+	char	buf[24];
+
+	sprintf(buf, "%lu", n);
+	return write(buf);
+}
+
+size_t Print::println()
+{
+	return write("\r\n");
+}
+
+size_t Print::println(const __FlashStringHelper *str)
+{
+	return print(str)+println();
+}
+
+size_t Print::println(const char *str)
+{
+	return print(str)+println();
+}
+
+size_t Print::println(long n)
+{
+	return print(n)+println();
+}
+
+size_t Print::println(unsigned long n)
+{
+	return print(n)+println();
+}
+
+void HardwareSerial::begin(unsigned long)
+{
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+	putchar(c);
+	return 1;
+}
+
+size_t HostPrint::write(uint8_t c)
+{
+	text += (char)c;
+	return 1;
+}
+
+// *** Panel ***
+
+HostPanel::HostPanel(int width, int height, byte bus, int CS, int RS, int WR, int SDA)
+{
+	_width	= width;
+	_height	= height;
+	_bus	= bus;
+	_cs		= CS;
+	_rs		= RS;
+	_wr		= WR;
+	_sda	= SDA;
+	_frame	= new word[long(width)*height];
+	reset();
+	for (int i=0; i<HOST_PANELS; i++)
+		if (_panels[i]==NULL)
+		{
+			_panels[i] = this;
+			break;
+		}
+}
+
+HostPanel::~HostPanel()
+{
+	for (int i=0; i<HOST_PANELS; i++)
+		if (_panels[i]==this)
+			_panels[i] = NULL;
+	delete[] _frame;
+}
+
+void HostPanel::reset()
+{
+	memset(_frame, 0, long(_width)*_height*sizeof(word));
+	clearCounts();
+	madctl	= 0;
+	_shift	= 0;
+	_nbits	= 0;
+	_cmd	= 0;
+	_nparam	= 0;
+	_x1 = _y1 = _x = _y = 0;
+	_x2 = _width-1;
+	_y2 = _height-1;
+	_high	= true;
+	_hi		= 0;
+}
+
+void HostPanel::clearCounts()
+{
+	stream.clear();
+	bits.clear();
+	com = data = edges = pixels = 0;
+}
+
+// With MV set columns run along the long side
+int HostPanel::columns()
+{
+	return (madctl & 0x20) ? _height : _width;
+}
+
+int HostPanel::pages()
+{
+	return (madctl & 0x20) ? _width : _height;
+}
+
+word HostPanel::pixel(int x, int y)
+{
+	if ((x<0) or (y<0) or (x>=columns()) or (y>=pages()))
+		return 0;
+	return _frame[(long(y)*columns())+x];
+}
+
+void HostPanel::_pin(byte pin, byte level)
+{
+	boolean	selected = (host_pins[_cs].value==LOW);
+
+	if ((pin==_cs) and (level==HIGH))
+	{
+		_shift = 0;			// Deselecting restarts the serial frame
+		_nbits = 0;
+	}
+	if ((pin!=_wr) or (level!=HIGH))
+		return;
+	edges++;
+	if (!selected)
+		return;
+	switch (_bus)
+	{
+	case HOST_BUS_16:
+		_write(host_pins[_rs].value, (PORTA<<8) | PORTC);
+		break;
+	case HOST_BUS_8:
+		_write(host_pins[_rs].value, PORTA);
+		break;
+	default:
+		_bit(host_pins[_sda].value);
+		break;
+	}
+}
+
+// A byte written to SPDR goes out on MOSI and SCK
+void HostPanel::_spi(byte value)
+{
+	if ((_bus<HOST_BUS_8) and (_sda==MOSI) and (_wr==SCK) and (host_pins[_cs].value==LOW))
+		for (byte mask=0x80; mask; mask>>=1)
+		{
+			edges++;
+			_bit((value & mask) ? 1 : 0);
+		}
+}
+
+// 4-pin frames are a D/C bit and 8 data bits, 5-pin frames take D/C from
+// RS when the last bit is clocked in
+void HostPanel::_bit(byte level)
+{
+	byte	rs = (_bus==HOST_BUS_SERIAL5) ? host_pins[_rs].value : 0;
+
+	bits.push_back(level | (rs<<1));
+	_shift = (_shift<<1) | level;
+	_nbits++;
+	if ((_bus==HOST_BUS_SERIAL4) and (_nbits==9))
+	{
+		_write((_shift>>8) & 1, _shift & 0xFF);
+		_shift = 0;
+		_nbits = 0;
+	}
+	else if ((_bus==HOST_BUS_SERIAL5) and (_nbits==8))
+	{
+		_write(rs, _shift & 0xFF);
+		_shift = 0;
+		_nbits = 0;
+	}
+}
+
+void HostPanel::_write(byte dc, word value)
+{
+	stream.push_back((long(dc)<<16) | value);
+	if (dc==0)
+	{
+		com++;
+		_cmd = value & 0xFF;
+		_nparam = 0;
+		if (_cmd==0x2C)
+		{
+			_x = _x1;
+			_y = _y1;
+			_high = true;
+		}
+		return;
+	}
+	data++;
+	switch (_cmd)
+	{
+	case 0x2A:
+	case 0x2B:
+		if (_nparam<4)
+			_params[_nparam++] = value & 0xFF;
+		if (_nparam==4)
+		{
+			if (_cmd==0x2A)
+			{
+				_x1 = (_params[0]<<8) | _params[1];
+				_x2 = (_params[2]<<8) | _params[3];
+			}
+			else
+			{
+				_y1 = (_params[0]<<8) | _params[1];
+				_y2 = (_params[2]<<8) | _params[3];
+			}
+		}
+		break;
+	case 0x36:
+		madctl = value & 0xFF;
+		break;
+	case 0x2C:
+	case 0x3C:
+		if (_bus==HOST_BUS_16)
+			_memory(value);
+		else if (_high)
+		{
+			_hi = value;
+			_high = false;
+		}
+		else
+		{
+			_memory((_hi<<8) | (value & 0xFF));
+			_high = true;
+		}
+		break;
+	}
+}
+
+// Memory is written across the window and wraps around at its end
+void HostPanel::_memory(word color)
+{
+	if ((_x<columns()) and (_y<pages()))
+		_frame[(long(_y)*columns())+_x] = color;
+	pixels++;
+	if (_x<_x2)
+		_x++;
+	else
+	{
+		_x = _x1;
+		_y = (_y<_y2) ? _y+1 : _y1;
+	}
+}
@@ -0,0 +1,100 @@
+/*
+  UTFT_Host.h - Arduino Mega simulation for the host build
+
+  The native environments in platformio.ini build UTFT and its add-on
+  libraries for the host, with this library in place of the Arduino
+  core. A HostPanel is wired to pins like a real module and decodes what
+  UTFT sends on them: WR pulses on a 16bit or 8bit bus, or SDA bits
+  clocked by SCL or sent through SPDR on a 4-pin or 5-pin serial bus.
+
+  Commands and parameters are interpreted as MIPI DCS, like the ILI9341
+  and ILI9486 do: column and page address set, memory write and memory
+  write continue, and memory access control. Pixels are kept in the
+  address space set by memory access control, so a panel rotated with
+  MV set is read back with x along its long side. Everything else is
+  only counted and recorded.
+
+  The latched 16bit bus and UNO shields are not simulated.
+*/
+
+#ifndef UTFT_Host_h
+#define UTFT_Host_h
+
+#include "Arduino.h"
+#include <vector>
+#include <string>
+
+#define HOST_PANELS			4
+
+#define HOST_BUS_16			16
+#define HOST_BUS_8			8
+#define HOST_BUS_SERIAL4	4
+#define HOST_BUS_SERIAL5	5
+
+class HostPanel
+{
+	public:
+		// width and height are the controller's, in portrait. RS is not used
+		// on a 4-pin serial bus, and SDA is only used on serial buses. On
+		// those WR is the SCL pin.
+		HostPanel(int width, int height, byte bus, int CS, int RS, int WR, int SDA=-1);
+		~HostPanel();
+
+		void	reset();			// Power on: memory black, counts and stream cleared
+		void	clearCounts();		// Counts and stream only
+		word	pixel(int x, int y);
+		int		columns();
+		int		pages();
+
+		unsigned long	com;		// Bus writes with RS or D/C low
+		unsigned long	data;		// Bus writes with RS or D/C high
+		unsigned long	edges;		// Rising edges of WR or SCL, whether CS is low or not
+		unsigned long	pixels;		// Pixels written to memory
+		byte			madctl;
+		// Every bus write while CS is low, as the D/C bit above the 16bit
+		// or 8bit value
+		std::vector<unsigned long>	stream;
+		// Every bit clocked in on a serial bus, with the level of RS in bit 1
+		std::vector<byte>			bits;
+
+		void	_pin(byte pin, byte level);
+		void	_spi(byte value);
+
+	private:
+		int		_width, _height;
+		byte	_bus;
+		int		_cs, _rs, _wr, _sda;
+		word	*_frame;
+		word	_shift;
+		byte	_nbits;
+		byte	_cmd, _nparam;
+		word	_params[4];
+		word	_x1, _x2, _y1, _y2, _x, _y;
+		boolean	_high;
+		byte	_hi;
+
+		void	_bit(byte level);
+		void	_write(byte dc, word value);
+		void	_memory(word color);
+};
+
+// Captures what is printed, e.g. by UTFT::printProfile()
+class HostPrint : public Print
+{
+	public:
+		size_t	write(uint8_t c);
+		using Print::write;
+
+		std::string	text;
+};
+
+// Sets every pin low, the clock to 0 and forgets the SPI registers
+void			host_reset();
+// Advances the clock as delay() does
+void			host_advance(unsigned long ms);
+
+// Allocations counted by the replaced operator new, and by String, which
+// allocates like the Arduino one does
+extern unsigned long	host_heap_allocs;
+
+#endif
@@ -0,0 +1,50 @@
+// Registers of the ATmega2560 that UTFT writes, for the host build. The
+// data ports are plain bytes that a HostPanel reads when WR rises. A byte
+// written to SPDR is shifted out at once, so SPIF is always set.
+#ifndef _AVR_IO_H_
+#define _AVR_IO_H_
+
+#include <stdint.h>
+
+#define _BV(bit)	(1 << (bit))
+
+#define FLASHEND	0x3FFFF
+
+#define SPIE		7
+#define SPE			6
+#define DORD		5
+#define MSTR		4
+#define CPOL		3
+#define CPHA		2
+#define SPR1		1
+#define SPR0		0
+#define SPIF		7
+#define SPI2X		0
+
+class HostSPDR
+{
+	public:
+		HostSPDR &operator=(uint8_t value);
+		operator uint8_t() const;
+
+		uint8_t	last;
+};
+
+class HostSPSR
+{
+	public:
+		HostSPSR &operator=(uint8_t value);
+		HostSPSR &operator|=(uint8_t value);
+		HostSPSR &operator&=(uint8_t value);
+		operator uint8_t() const;
+
+		uint8_t	value;
+};
+
+extern volatile uint8_t	PORTA, PORTB, PORTC, PORTD, PORTE, PORTF, PORTG, PORTH;
+extern volatile uint8_t	DDRA, DDRB, DDRC, DDRD, DDRE, DDRF, DDRG, DDRH;
+extern volatile uint8_t	SPCR;
+extern HostSPSR			SPSR;
+extern HostSPDR			SPDR;
+
+#endif
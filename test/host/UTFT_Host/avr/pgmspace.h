@@ -0,0 +1,33 @@
+// Flash access for the host build. Flash and RAM are the same memory on
+// the host, so the reads are plain loads and far addresses are pointers.
+#ifndef __PGMSPACE_H_
+#define __PGMSPACE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P				const char *
+#define PSTR(s)				(s)
+
+typedef uintptr_t uint_farptr_t;
+
+static inline uint16_t _host_read_word(const void *p)
+{
+	uint16_t	v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+#define pgm_read_byte(addr)			(*(const uint8_t *)(uintptr_t)(addr))
+#define pgm_read_word(addr)			_host_read_word((const void *)(uintptr_t)(addr))
+#define pgm_read_ptr(addr)			(*(void * const *)(uintptr_t)(addr))
+#define pgm_read_byte_far(addr)		pgm_read_byte(addr)
+#define pgm_read_word_far(addr)		pgm_read_word(addr)
+#define pgm_get_far_address(v)		((uint_farptr_t)&(v))
+#define memcpy_P(dst, src, len)		memcpy(dst, src, len)
+#define memcpy_PF(dst, src, len)	memcpy(dst, (const void *)(uintptr_t)(src), len)
+#define strlen_P(s)					strlen(s)
+
+#endif
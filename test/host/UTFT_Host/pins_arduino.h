@@ -0,0 +1,19 @@
+// Pins of the Arduino Mega for the host build. Every pin is a port of
+// its own, bit 0 of a HostReg, see Arduino.h.
+#ifndef Pins_Arduino_h
+#define Pins_Arduino_h
+
+#include <stdint.h>
+
+#define NUM_DIGITAL_PINS	70
+
+static const uint8_t SS   = 53;
+static const uint8_t MOSI = 51;
+static const uint8_t MISO = 50;
+static const uint8_t SCK  = 52;
+
+#define digitalPinToPort(p)		(p)
+#define digitalPinToBitMask(p)	1
+#define portOutputRegister(p)	(&host_pins[(p)])
+
+#endif
@@ -0,0 +1,190 @@
+// Checks that print() and printNumI() don't touch the heap: operator new
+// and, with glibc, malloc() are counted while they draw. printNumI() is
+// also compared pixel for pixel with print() of the same number.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_Host.h>
+#include <limits.h>
+#include <stdio.h>
+
+extern uint8_t BigFont[];
+
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS		40
+#define LCD_RST		41
+
+#define TEXT_W		(12*16)
+#define TEXT_H		16
+
+static HostPanel	*panel;
+static UTFT			*lcd;
+
+// The operator new in UTFT_Host.cpp calls malloc(), so this counts what
+// it counts and anything that goes to malloc() directly
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__)
+#define HOST_MALLOC_SHIM
+
+extern "C" void	*__libc_malloc(size_t size);
+extern "C" void	*__libc_calloc(size_t n, size_t size);
+extern "C" void	*__libc_realloc(void *p, size_t size);
+extern "C" void	__libc_free(void *p);
+
+static unsigned long	_mallocs = 0;
+
+extern "C" void *malloc(size_t size)
+{
+	_mallocs++;
+	return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t n, size_t size)
+{
+	_mallocs++;
+	return __libc_calloc(n, size);
+}
+
+extern "C" void *realloc(void *p, size_t size)
+{
+	_mallocs++;
+	return __libc_realloc(p, size);
+}
+
+extern "C" void free(void *p)
+{
+	__libc_free(p);
+}
+#endif
+
+static unsigned long heap_count()
+{
+#ifdef HOST_MALLOC_SHIM
+	return host_heap_allocs+_mallocs;
+#else
+	return host_heap_allocs;
+#endif
+}
+
+// The panel records every bus write, so make room before counting
+static unsigned long start()
+{
+	panel->clearCounts();
+	panel->stream.reserve(65536);
+	return heap_count();
+}
+
+static void check(unsigned long before, const char *what)
+{
+	TEST_ASSERT_EQUAL_MESSAGE(before, heap_count(), what);
+	TEST_ASSERT_TRUE_MESSAGE(panel->pixels>0, what);
+}
+
+static void snapshot(word *buf)
+{
+	for (int y=0; y<TEXT_H; y++)
+		for (int x=0; x<TEXT_W; x++)
+			buf[y*TEXT_W+x] = panel->pixel(x, y);
+}
+
+void setUp()
+{
+	host_reset();
+	panel = new HostPanel(320, 480, HOST_BUS_16, LCD_CS, LCD_RS, LCD_WR);
+	lcd = new UTFT(ILI9486, LCD_RS, LCD_WR, LCD_CS, LCD_RST);
+	lcd->InitLCD(LANDSCAPE);
+	lcd->setFont(BigFont);
+	lcd->setColor(VGA_WHITE);
+	lcd->setBackColor(VGA_BLUE);
+}
+
+void tearDown()
+{
+	delete lcd;
+	delete panel;
+}
+
+void test_print()
+{
+	static const char	text[] = "GAME TIMER: ";
+	String				st("RED TEAM:");
+	unsigned long		before;
+
+	before = start();
+	lcd->print(F("GAME TIMER: "), 0, 0);
+	check(before, "print(F())");
+
+	before = start();
+	lcd->print(text, 0, 20);
+	check(before, "print(const char*)");
+
+	before = start();
+	lcd->print(st, 0, 40);
+	check(before, "print(const String&)");
+}
+
+void test_printnum()
+{
+	unsigned long	before;
+
+	before = start();
+	lcd->printNumI(-1234, 0, 0);
+	check(before, "printNumI(int)");
+
+	before = start();
+	lcd->printNumI(65535U, 0, 20, 7, '0');
+	check(before, "printNumI(unsigned int)");
+
+	before = start();
+	lcd->printNumI(LONG_MIN, 0, 40);
+	check(before, "printNumI(long)");
+
+	before = start();
+	lcd->printNumI(4294967295UL, 0, 60, 11);
+	check(before, "printNumI(unsigned long)");
+}
+
+// printNumI() draws what print() draws for the same digits
+void test_printnum_pixels()
+{
+	static const long	nums[] = {0, 7, -7, 1000, -1234, 2147483647L, LONG_MIN};
+	static word			want[TEXT_W*TEXT_H], got[TEXT_W*TEXT_H];
+	char				buf[24];
+
+	for (byte i=0; i<sizeof(nums)/sizeof(nums[0]); i++)
+	{
+		lcd->clrScr();
+		snprintf(buf, sizeof(buf), "%ld", nums[i]);
+		lcd->print(buf, 0, 0);
+		snapshot(want);
+
+		lcd->clrScr();
+		lcd->printNumI(nums[i], 0, 0);
+		snapshot(got);
+		TEST_ASSERT_EQUAL_MESSAGE(0, memcmp(want, got, sizeof(want)), buf);
+
+		// Padded to 12 characters with the sign in front, as the old
+		// printNumI() put it
+		lcd->clrScr();
+		if (nums[i]<0)
+			snprintf(buf, sizeof(buf), "-%011lu", 0UL-(unsigned long)nums[i]);
+		else
+			snprintf(buf, sizeof(buf), "%012ld", nums[i]);
+		lcd->print(buf, 0, 0);
+		snapshot(want);
+
+		lcd->clrScr();
+		lcd->printNumI(nums[i], 0, 0, 12, '0');
+		snapshot(got);
+		TEST_ASSERT_EQUAL_MESSAGE(0, memcmp(want, got, sizeof(want)), buf);
+	}
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_print);
+	RUN_TEST(test_printnum);
+	RUN_TEST(test_printnum_pixels);
+	return UNITY_END();
+}
@@ -0,0 +1,139 @@
+// Checks drawAtlasRegion() on regions that touch the edges of the sheet:
+// the corners, whole rows and columns, single pixels and the whole
+// sheet. Each must show exactly its rectangle of the sheet and leave the
+// pixels around it alone.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_Host.h>
+
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS		40
+#define LCD_RST		41
+
+#define BACKGROUND	0x1234
+
+#define ATLAS_W		17
+#define ATLAS_H		11
+#define REGIONS		11
+
+static HostPanel	*panel;
+static UTFT			*lcd;
+static boolean		rotated;	// LANDSCAPE without memory access control
+
+static unsigned int	atlas[ATLAS_W*ATLAS_H];
+
+static unsigned int	regions[ATLAS_HEADER_SIZE+(REGIONS*ATLAS_REGION_SIZE)] = {
+	ATLAS_W, REGIONS,
+	0, 0, 5, 4,								// Top left corner
+	ATLAS_W-6, 0, 6, 3,						// Top right corner
+	0, ATLAS_H-2, 7, 2,						// Bottom left corner
+	ATLAS_W-4, ATLAS_H-5, 4, 5,				// Bottom right corner
+	0, 0, ATLAS_W, ATLAS_H,					// Whole sheet
+	0, ATLAS_H-1, ATLAS_W, 1,				// Last row
+	ATLAS_W-1, 0, 1, ATLAS_H,				// Last column
+	ATLAS_W-1, ATLAS_H-1, 1, 1,				// Last pixel
+	0, 0, 1, 1,								// First pixel
+	0, 4, ATLAS_W, 3,						// Full width, inside
+	6, 0, 3, ATLAS_H,						// Full height, inside
+};
+
+static void open(byte model, byte orientation)
+{
+	host_reset();
+	panel = new HostPanel(320, 480, HOST_BUS_16, LCD_CS, LCD_RS, LCD_WR);
+	lcd = new UTFT(model, LCD_RS, LCD_WR, LCD_CS, LCD_RST);
+	lcd->InitLCD(orientation);
+	rotated = (lcd->orient==LANDSCAPE);
+}
+
+// Reads back logical (x,y)
+static word at(int x, int y)
+{
+	if (rotated)
+		return panel->pixel(y, 479-x);
+	return panel->pixel(x, y);
+}
+
+static void check(int x, int y, int id)
+{
+	unsigned int	*r = &regions[ATLAS_HEADER_SIZE+(id*ATLAS_REGION_SIZE)];
+	int				rx = r[0], ry = r[1], rw = r[2], rh = r[3];
+	word			want;
+	char			msg[48];
+
+	snprintf(msg, sizeof(msg), "region %d at %d,%d", id, x, y);
+	lcd->fillScr(BACKGROUND);
+	panel->clearCounts();
+	lcd->drawAtlasRegion(x, y, atlas, regions, id);
+	TEST_ASSERT_EQUAL_MESSAGE(long(rw)*rh, panel->pixels, msg);
+	for (int ty=-1; ty<=rh; ty++)
+		for (int tx=-1; tx<=rw; tx++)
+		{
+			if ((tx<0) or (ty<0) or (tx>=rw) or (ty>=rh))
+				want = BACKGROUND;
+			else
+				want = atlas[(ry+ty)*ATLAS_W+rx+tx];
+			TEST_ASSERT_EQUAL_MESSAGE(want, at(x+tx, y+ty), msg);
+		}
+}
+
+static void check_all()
+{
+	for (int id=0; id<REGIONS; id++)
+	{
+		check(1, 1, id);
+		check(200, 150, id);
+	}
+
+	// Not in the table
+	panel->clearCounts();
+	lcd->drawAtlasRegion(0, 0, atlas, regions, REGIONS);
+	lcd->drawAtlasRegion(0, 0, atlas, regions, -1);
+	TEST_ASSERT_EQUAL(0, panel->edges);
+}
+
+void setUp()
+{
+	for (int i=0; i<ATLAS_W*ATLAS_H; i++)
+		atlas[i] = 0x0101*i + 0x0400;
+	panel = NULL;
+	lcd = NULL;
+}
+
+void tearDown()
+{
+	delete lcd;
+	delete panel;
+}
+
+void test_portrait()
+{
+	open(ILI9486, PORTRAIT);
+	check_all();
+}
+
+void test_madctl_landscape()
+{
+	open(ILI9486, LANDSCAPE);
+	TEST_ASSERT_FALSE(rotated);
+	check_all();
+}
+
+// Rows are sent right to left into a panel column
+void test_landscape()
+{
+	open(ILI9488, LANDSCAPE);
+	TEST_ASSERT_TRUE(rotated);
+	check_all();
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_portrait);
+	RUN_TEST(test_madctl_landscape);
+	RUN_TEST(test_landscape);
+	return UNITY_END();
+}
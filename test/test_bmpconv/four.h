@@ -0,0 +1,11 @@
+// Generated by	: ImageConverter 565 v2.3
+// Dimensions		: 13x5 pixels
+// Size			: 130 Bytes
+
+const unsigned short four[65] PROGMEM={
+0x001F,0xFFE0,0x07FF,0xF81F,0x001F,0xFFE0,0x07FF,0xF81F,0x001F,0xFFE0,0x07FF,0xF81F,0x001F,0x07FF,0xF81F,0x001F,
+0xFFE0,0x07FF,0xF81F,0x001F,0xFFE0,0x07FF,0xF81F,0x001F,0xFFE0,0x07FF,0x001F,0xFFE0,0x07FF,0xF81F,0x001F,0xFFE0,
+0x07FF,0xF81F,0x001F,0xFFE0,0x07FF,0xF81F,0x001F,0x07FF,0xF81F,0x001F,0xFFE0,0x07FF,0xF81F,0x001F,0xFFE0,0x07FF,
+0xF81F,0x001F,0xFFE0,0x07FF,0x001F,0xFFE0,0x07FF,0xF81F,0x001F,0xFFE0,0x07FF,0xF81F,0x001F,0xFFE0,0x07FF,0xF81F,
+0x001F,
+};
@@ -0,0 +1,22 @@
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#elif defined(__PIC32MX__)
+	#define PROGMEM
+#elif defined(__arm__)
+	#define PROGMEM
+#endif
+
+// four_palette.c
+// Generated from	: four.h
+// Dimensions		: 13x5 pixels
+// Format			: BITMAP_PALETTE, 2 bpp, 4 colors
+// Memory usage	: 32 bytes (raw 130 bytes)
+//
+// Draw with myGLCD.drawCompressedBitmap(x, y, four_palette);
+
+const unsigned char four_palette[32] PROGMEM={
+0x02,0x02,0x0D,0x00,0x05,0x00,  // header
+0x03,0x1F,0x00,0xFF,0x07,0x1F,0xF8,0xE0,0xFF,  // palette
+0x36,0x36,0x36,0x18,0xD8,0xD8,0xD3,0x63,0x63,0x61,0x8D,0x8D,0x8D,0x36,0x36,0x36,
+0x00,
+};
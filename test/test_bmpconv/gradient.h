@@ -0,0 +1,25 @@
+// Generated by	: ImageConverter 565 v2.3
+// Dimensions		: 30x10 pixels
+// Size			: 600 Bytes
+
+const unsigned short gradient[300] PROGMEM={
+0x0000,0x2E65,0x5CCA,0x8B2F,0xB994,0xE7F9,0x1B96,0x49FB,0x7860,0xA6C5,0xD52A,0x08C7,0x372C,0x6591,0x93F6,0xC25B,
+0xF0C0,0x245D,0x52C2,0x8127,0xAF8C,0xDDF1,0x118E,0x3FF3,0x6E58,0x9CBD,0xCB22,0xF987,0x2D24,0x5B89,0x89EE,0xB853,
+0xE6B8,0x1A55,0x48BA,0x771F,0xA584,0xD3E9,0x0786,0x35EB,0x6450,0x92B5,0xC11A,0xEF7F,0x231C,0x5181,0x7FE6,0xAE4B,
+0xDCB0,0x104D,0x3EB2,0x6D17,0x9B7C,0xC9E1,0xF846,0x2BE3,0x5A48,0x88AD,0xB712,0xE577,0x1914,0x4779,0x75DE,0xA443,
+0xD2A8,0x0645,0x34AA,0x630F,0x9174,0xBFD9,0xEE3E,0x21DB,0x5040,0x7EA5,0xAD0A,0xDB6F,0x0F0C,0x3D71,0x6BD6,0x9A3B,
+0xC8A0,0xF705,0x2AA2,0x5907,0x876C,0xB5D1,0xE436,0x17D3,0x4638,0x749D,0xA302,0xD167,0x0504,0x3369,0x61CE,0x9033,
+0xBE98,0xECFD,0x209A,0x4EFF,0x7D64,0xABC9,0xDA2E,0x0DCB,0x3C30,0x6A95,0x98FA,0xC75F,0xF5C4,0x2961,0x57C6,0x862B,
+0xB490,0xE2F5,0x1692,0x44F7,0x735C,0xA1C1,0xD026,0x03C3,0x3228,0x608D,0x8EF2,0xBD57,0xEBBC,0x1F59,0x4DBE,0x7C23,
+0xAA88,0xD8ED,0x0C8A,0x3AEF,0x6954,0x97B9,0xC61E,0xF483,0x2820,0x5685,0x84EA,0xB34F,0xE1B4,0x1551,0x43B6,0x721B,
+0xA080,0xCEE5,0x0282,0x30E7,0x5F4C,0x8DB1,0xBC16,0xEA7B,0x1E18,0x4C7D,0x7AE2,0xA947,0xD7AC,0x0B49,0x39AE,0x6813,
+0x9678,0xC4DD,0xF342,0x26DF,0x5544,0x83A9,0xB20E,0xE073,0x1410,0x4275,0x70DA,0x9F3F,0xCDA4,0x0141,0x2FA6,0x5E0B,
+0x8C70,0xBAD5,0xE93A,0x1CD7,0x4B3C,0x79A1,0xA806,0xD66B,0x0A08,0x386D,0x66D2,0x9537,0xC39C,0xF201,0x259E,0x5403,
+0x8268,0xB0CD,0xDF32,0x12CF,0x4134,0x6F99,0x9DFE,0xCC63,0x0000,0x2E65,0x5CCA,0x8B2F,0xB994,0xE7F9,0x1B96,0x49FB,
+0x7860,0xA6C5,0xD52A,0x08C7,0x372C,0x6591,0x93F6,0xC25B,0xF0C0,0x245D,0x52C2,0x8127,0xAF8C,0xDDF1,0x118E,0x3FF3,
+0x6E58,0x9CBD,0xCB22,0xF987,0x2D24,0x5B89,0x89EE,0xB853,0xE6B8,0x1A55,0x48BA,0x771F,0xA584,0xD3E9,0x0786,0x35EB,
+0x6450,0x92B5,0xC11A,0xEF7F,0x231C,0x5181,0x7FE6,0xAE4B,0xDCB0,0x104D,0x3EB2,0x6D17,0x9B7C,0xC9E1,0xF846,0x2BE3,
+0x5A48,0x88AD,0xB712,0xE577,0x1914,0x4779,0x75DE,0xA443,0xD2A8,0x0645,0x34AA,0x630F,0x9174,0xBFD9,0xEE3E,0x21DB,
+0x5040,0x7EA5,0xAD0A,0xDB6F,0x0F0C,0x3D71,0x6BD6,0x9A3B,0xC8A0,0xF705,0x2AA2,0x5907,0x876C,0xB5D1,0xE436,0x17D3,
+0x4638,0x749D,0xA302,0xD167,0x0504,0x3369,0x61CE,0x9033,0xBE98,0xECFD,0x209A,0x4EFF,
+};
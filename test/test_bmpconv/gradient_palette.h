@@ -0,0 +1,39 @@
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#elif defined(__PIC32MX__)
+	#define PROGMEM
+#elif defined(__arm__)
+	#define PROGMEM
+#endif
+
+// gradient_palette.c
+// Generated from	: gradient.h
+// Dimensions		: 30x10 pixels
+// Format			: BITMAP_PALETTE, 8 bpp, 200 colors
+// Memory usage	: 707 bytes (raw 600 bytes)
+//
+// Draw with myGLCD.drawCompressedBitmap(x, y, gradient_palette);
+
+const unsigned char gradient_palette[707] PROGMEM={
+0x02,0x08,0x1E,0x00,0x0A,0x00,  // header
+0xC7,0x00,0x00,0x41,0x01,0x82,0x02,0xC3,0x03,0x04,0x05,0x45,0x06,0x86,0x07,0xC7,0x08,0x08,0x0A,0x49,0x0B,0x8A,0x0C,0xCB,0x0D,0x0C,0x0F,0x4D,0x10,0x8E,0x11,0xCF,0x12,0x10,0x14,0x51,0x15,0x92,0x16,0xD3,0x17,0x14,0x19,0x55,0x1A,0x96,0x1B,0xD7,0x1C,0x18,0x1E,0x59,0x1F,0x9A,0x20,0xDB,0x21,0x1C,0x23,0x5D,0x24,0x9E,0x25,0xDF,0x26,0x20,0x28,0x61,0x29,0xA2,0x2A,0xE3,0x2B,0x24,0x2D,0x65,0x2E,0xA6,0x2F,0xE7,0x30,0x28,0x32,0x69,0x33,0xAA,0x34,0xEB,0x35,0x2C,0x37,0x6D,0x38,0xAE,0x39,0xEF,0x3A,0x30,0x3C,0x71,0x3D,0xB2,0x3E,0xF3,0x3F,0x34,0x41,0x75,0x42,0xB6,0x43,0xF7,0x44,0x38,0x46,0x79,0x47,0xBA,0x48,0xFB,0x49,0x3C,0x4B,0x7D,0x4C,0xBE,0x4D,0xFF,0x4E,0x40,0x50,0x81,0x51,0xC2,0x52,0x03,0x54,0x44,0x55,0x85,0x56,0xC6,0x57,0x07,0x59,0x48,0x5A,0x89,0x5B,0xCA,0x5C,0x0B,0x5E,0x4C,0x5F,0x8D,0x60,0xCE,0x61,0x0F,0x63,0x50,0x64,0x91,0x65,0xD2,0x66,0x13,0x68,0x54,0x69,0x95,0x6A,0xD6,0x6B,0x17,0x6D,0x58,0x6E,0x99,0x6F,0xDA,0x70,0x1B,0x72,0x5C,0x73,0x9D,0x74,0xDE,0x75,0x1F,0x77,0x60,0x78,0xA1,0x79,0xE2,0x7A,0x23,0x7C,0x64,0x7D,0xA5,0x7E,0xE6,0x7F,0x27,0x81,0x68,0x82,0xA9,0x83,0xEA,0x84,0x2B,0x86,0x6C,0x87,0xAD,0x88,0xEE,0x89,0x2F,0x8B,0x70,0x8C,0xB1,0x8D,0xF2,0x8E,0x33,0x90,0x74,0x91,0xB5,0x92,0xF6,0x93,0x37,0x95,0x78,0x96,0xB9,0x97,0xFA,0x98,0x3B,0x9A,0x7C,0x9B,0xBD,0x9C,0xFE,0x9D,0x3F,0x9F,0x80,0xA0,0xC1,0xA1,0x02,0xA3,0x43,0xA4,0x84,0xA5,0xC5,0xA6,0x06,0xA8,0x47,0xA9,0x88,0xAA,0xC9,0xAB,0x0A,0xAD,0x4B,0xAE,0x8C,0xAF,0xCD,0xB0,0x0E,0xB2,0x4F,0xB3,0x90,0xB4,0xD1,0xB5,0x12,0xB7,0x53,0xB8,0x94,0xB9,0xD5,0xBA,0x16,0xBC,0x57,0xBD,0x98,0xBE,0xD9,0xBF,0x1A,0xC1,0x5B,0xC2,0x9C,0xC3,0xDD,0xC4,0x1E,0xC6,0x5F,0xC7,0xA0,0xC8,0xE1,0xC9,0x22,0xCB,0x63,0xCC,0xA4,0xCD,0xE5,0xCE,0x26,0xD0,0x67,0xD1,0xA8,0xD2,0xE9,0xD3,0x2A,0xD5,0x6B,0xD6,0xAC,0xD7,0xED,0xD8,0x2E,0xDA,0x6F,0xDB,0xB0,0xDC,0xF1,0xDD,0x32,0xDF,0x73,0xE0,0xB4,0xE1,0xF5,0xE2,0x36,0xE4,0x77,0xE5,0xB8,0xE6,0xF9,0xE7,0x3A,0xE9,0x7B,0xEA,0xBC,0xEB,0xFD,0xEC,0x3E,0xEE,0x7F,0xEF,0xC0,0xF0,0x01,0xF2,0x42,0xF3,0x83,0xF4,0xC4,0xF5,0x05,0xF7,0x46,0xF8,0x87,0xF9,  // palette
+0x00,0x25,0x4A,0x6F,0x94,0xB9,0x16,0x3B,0x60,0x85,0xAA,0x07,0x2C,0x51,0x76,0x9B,
+0xC0,0x1D,0x42,0x67,0x8C,0xB1,0x0E,0x33,0x58,0x7D,0xA2,0xC7,0x24,0x49,0x6E,0x93,
+0xB8,0x15,0x3A,0x5F,0x84,0xA9,0x06,0x2B,0x50,0x75,0x9A,0xBF,0x1C,0x41,0x66,0x8B,
+0xB0,0x0D,0x32,0x57,0x7C,0xA1,0xC6,0x23,0x48,0x6D,0x92,0xB7,0x14,0x39,0x5E,0x83,
+0xA8,0x05,0x2A,0x4F,0x74,0x99,0xBE,0x1B,0x40,0x65,0x8A,0xAF,0x0C,0x31,0x56,0x7B,
+0xA0,0xC5,0x22,0x47,0x6C,0x91,0xB6,0x13,0x38,0x5D,0x82,0xA7,0x04,0x29,0x4E,0x73,
+0x98,0xBD,0x1A,0x3F,0x64,0x89,0xAE,0x0B,0x30,0x55,0x7A,0x9F,0xC4,0x21,0x46,0x6B,
+0x90,0xB5,0x12,0x37,0x5C,0x81,0xA6,0x03,0x28,0x4D,0x72,0x97,0xBC,0x19,0x3E,0x63,
+0x88,0xAD,0x0A,0x2F,0x54,0x79,0x9E,0xC3,0x20,0x45,0x6A,0x8F,0xB4,0x11,0x36,0x5B,
+0x80,0xA5,0x02,0x27,0x4C,0x71,0x96,0xBB,0x18,0x3D,0x62,0x87,0xAC,0x09,0x2E,0x53,
+0x78,0x9D,0xC2,0x1F,0x44,0x69,0x8E,0xB3,0x10,0x35,0x5A,0x7F,0xA4,0x01,0x26,0x4B,
+0x70,0x95,0xBA,0x17,0x3C,0x61,0x86,0xAB,0x08,0x2D,0x52,0x77,0x9C,0xC1,0x1E,0x43,
+0x68,0x8D,0xB2,0x0F,0x34,0x59,0x7E,0xA3,0x00,0x25,0x4A,0x6F,0x94,0xB9,0x16,0x3B,
+0x60,0x85,0xAA,0x07,0x2C,0x51,0x76,0x9B,0xC0,0x1D,0x42,0x67,0x8C,0xB1,0x0E,0x33,
+0x58,0x7D,0xA2,0xC7,0x24,0x49,0x6E,0x93,0xB8,0x15,0x3A,0x5F,0x84,0xA9,0x06,0x2B,
+0x50,0x75,0x9A,0xBF,0x1C,0x41,0x66,0x8B,0xB0,0x0D,0x32,0x57,0x7C,0xA1,0xC6,0x23,
+0x48,0x6D,0x92,0xB7,0x14,0x39,0x5E,0x83,0xA8,0x05,0x2A,0x4F,0x74,0x99,0xBE,0x1B,
+0x40,0x65,0x8A,0xAF,0x0C,0x31,0x56,0x7B,0xA0,0xC5,0x22,0x47,0x6C,0x91,0xB6,0x13,
+0x38,0x5D,0x82,0xA7,0x04,0x29,0x4E,0x73,0x98,0xBD,0x1A,0x3F,
+};
@@ -0,0 +1,18 @@
+// Generated by	: ImageConverter 565 v2.3
+// Dimensions		: 21x9 pixels
+// Size			: 378 Bytes
+
+const unsigned short mono[189] PROGMEM={
+0xFFFF,0xFFFF,0x0010,0xFFFF,0xFFFF,0x0010,0xFFFF,0xFFFF,0xFFFF,0x0010,0xFFFF,0xFFFF,0x0010,0xFFFF,0xFFFF,0xFFFF,
+0x0010,0xFFFF,0xFFFF,0x0010,0xFFFF,0x0010,0x0010,0xFFFF,0x0010,0x0010,0xFFFF,0x0010,0x0010,0x0010,0xFFFF,0x0010,
+0x0010,0xFFFF,0x0010,0x0010,0x0010,0xFFFF,0x0010,0x0010,0xFFFF,0x0010,0x0010,0xFFFF,0x0010,0xFFFF,0xFFFF,0x0010,
+0xFFFF,0x0010,0xFFFF,0x0010,0xFFFF,0xFFFF,0x0010,0xFFFF,0x0010,0xFFFF,0x0010,0xFFFF,0xFFFF,0x0010,0xFFFF,0xFFFF,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0xFFFF,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0xFFFF,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0x0010,0x0010,0x0010,0xFFFF,0xFFFF,0xFFFF,
+0xFFFF,0x0010,0x0010,0x0010,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0x0010,0xFFFF,0xFFFF,0x0010,0x0010,0x0010,0x0010,0xFFFF,
+0xFFFF,0xFFFF,0x0010,0x0010,0x0010,0x0010,0xFFFF,0xFFFF,0xFFFF,0x0010,0x0010,0x0010,0x0010,0xFFFF,0x0010,0x0010,
+0xFFFF,0x0010,0x0010,0xFFFF,0x0010,0x0010,0x0010,0xFFFF,0x0010,0x0010,0xFFFF,0x0010,0x0010,0x0010,0xFFFF,0x0010,
+0x0010,0xFFFF,0x0010,0xFFFF,0xFFFF,0x0010,0xFFFF,0xFFFF,0x0010,0xFFFF,0xFFFF,0xFFFF,0x0010,0xFFFF,0xFFFF,0x0010,
+0xFFFF,0xFFFF,0xFFFF,0x0010,0xFFFF,0xFFFF,0x0010,0xFFFF,0x0010,0x0010,0xFFFF,0x0010,0x0010,0xFFFF,0x0010,0x0010,
+0x0010,0xFFFF,0x0010,0x0010,0xFFFF,0x0010,0x0010,0x0010,0xFFFF,0x0010,0x0010,0xFFFF,0x0010,
+};
@@ -0,0 +1,22 @@
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#elif defined(__PIC32MX__)
+	#define PROGMEM
+#elif defined(__arm__)
+	#define PROGMEM
+#endif
+
+// mono_palette.c
+// Generated from	: mono.h
+// Dimensions		: 21x9 pixels
+// Format			: BITMAP_PALETTE, 1 bpp, 2 colors
+// Memory usage	: 35 bytes (raw 378 bytes)
+//
+// Draw with myGLCD.drawCompressedBitmap(x, y, mono_palette);
+
+const unsigned char mono_palette[35] PROGMEM={
+0x02,0x01,0x15,0x00,0x09,0x00,  // header
+0x01,0x10,0x00,0xFF,0xFF,  // palette
+0xDB,0xB7,0x69,0x22,0x44,0x96,0xAD,0x5B,0x02,0x04,0x03,0xC7,0x8F,0x61,0xC3,0x84,
+0x91,0x22,0x5B,0x76,0xED,0x24,0x48,0x90,
+};
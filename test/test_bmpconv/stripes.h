@@ -0,0 +1,56 @@
+// Generated by	: ImageConverter 565 v2.3
+// Dimensions		: 40x20 pixels
+// Size			: 1600 Bytes
+
+const unsigned short stripes[800] PROGMEM={
+0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+0x001F,0x001F,0x001F,0xFFE0,0xFFE0,0xFFE0,0x07FF,0x07FF,0x07FF,0xF81F,0xF81F,0xF81F,0x8410,0x8410,0x8410,0x4208,
+0x4208,0x4208,0xFD20,0xFD20,0xFD20,0x1234,0x1234,0x1234,0x0000,0x0000,0x0000,0xFFFF,0xFFFF,0xFFFF,0xF800,0xF800,
+0xF800,0x07E0,0x07E0,0x07E0,0x001F,0x001F,0x001F,0xFFE0,0xFFE0,0xFFE0,0xFFE0,0x07FF,0x07FF,0x07FF,0xF81F,0xF81F,
+0xF81F,0x8410,0x8410,0x8410,0x4208,0x4208,0x4208,0xFD20,0xFD20,0xFD20,0x1234,0x1234,0x1234,0x0000,0x0000,0x0000,
+0xFFFF,0xFFFF,0xFFFF,0xF800,0xF800,0xF800,0x07E0,0x07E0,0x07E0,0x001F,0x001F,0x001F,0xFFE0,0xFFE0,0xFFE0,0x07FF,
+0x07FF,0x07FF,0x07FF,0xF81F,0xF81F,0xF81F,0x8410,0x8410,0x8410,0x4208,0x4208,0x4208,0xFD20,0xFD20,0xFD20,0x1234,
+0x1234,0x1234,0x0000,0x0000,0x0000,0xFFFF,0xFFFF,0xFFFF,0xF800,0xF800,0xF800,0x07E0,0x07E0,0x07E0,0x001F,0x001F,
+0x001F,0xFFE0,0xFFE0,0xFFE0,0x07FF,0x07FF,0x07FF,0xF81F,0xF81F,0xF81F,0xF81F,0x8410,0x8410,0x8410,0x4208,0x4208,
+0x4208,0xFD20,0xFD20,0xFD20,0x1234,0x1234,0x1234,0x0000,0x0000,0x0000,0xFFFF,0xFFFF,0xFFFF,0xF800,0xF800,0xF800,
+0x07E0,0x07E0,0x07E0,0x001F,0x001F,0x001F,0xFFE0,0xFFE0,0xFFE0,0x07FF,0x07FF,0x07FF,0xF81F,0xF81F,0xF81F,0x8410,
+0x8410,0x8410,0x8410,0x4208,0x4208,0x4208,0xFD20,0xFD20,0xFD20,0x1234,0x1234,0x1234,0x0000,0x0000,0x0000,0xFFFF,
+0xFFFF,0xFFFF,0xF800,0xF800,0xF800,0x07E0,0x07E0,0x07E0,0x001F,0x001F,0x001F,0xFFE0,0xFFE0,0xFFE0,0x07FF,0x07FF,
+0x07FF,0xF81F,0xF81F,0xF81F,0x8410,0x8410,0x8410,0x4208,0x4208,0x4208,0x4208,0xFD20,0xFD20,0xFD20,0x1234,0x1234,
+0x1234,0x0000,0x0000,0x0000,0xFFFF,0xFFFF,0xFFFF,0xF800,0xF800,0xF800,0x07E0,0x07E0,0x07E0,0x001F,0x001F,0x001F,
+0xFFE0,0xFFE0,0xFFE0,0x07FF,0x07FF,0x07FF,0xF81F,0xF81F,0xF81F,0x8410,0x8410,0x8410,0x4208,0x4208,0x4208,0xFD20,
+0xFD20,0xFD20,0xFD20,0x1234,0x1234,0x1234,0x0000,0x0000,0x0000,0xFFFF,0xFFFF,0xFFFF,0xF800,0xF800,0xF800,0x07E0,
+0x07E0,0x07E0,0x001F,0x001F,0x001F,0xFFE0,0xFFE0,0xFFE0,0x07FF,0x07FF,0x07FF,0xF81F,0xF81F,0xF81F,0x8410,0x8410,
+0x8410,0x4208,0x4208,0x4208,0xFD20,0xFD20,0xFD20,0x1234,0x1234,0x1234,0x1234,0x0000,0x0000,0x0000,0xFFFF,0xFFFF,
+0xFFFF,0xF800,0xF800,0xF800,0x07E0,0x07E0,0x07E0,0x001F,0x001F,0x001F,0xFFE0,0xFFE0,0xFFE0,0x07FF,0x07FF,0x07FF,
+0xF81F,0xF81F,0xF81F,0x8410,0x8410,0x8410,0x4208,0x4208,0x4208,0xFD20,0xFD20,0xFD20,0x1234,0x1234,0x1234,0x0000,
+0xF800,0xF800,0xF800,0xF800,0x001F,0xF800,0xF800,0xF800,0xF800,0xFFE0,0xF800,0xF800,0xF800,0x0000,0xF800,0x1234,
+0x1234,0xFD20,0x0000,0xFFE0,0xFFE0,0xFFFF,0xFFE0,0xF800,0xF800,0xF800,0x1234,0xF800,0xF800,0x07FF,0xF800,0x4208,
+0xF800,0x8410,0xF800,0xF800,0xF800,0xF800,0xF800,0x07FF,0x07E0,0xFD20,0x4208,0xF800,0x4208,0xF800,0xFD20,0xFFFF,
+0xF800,0xF800,0xF800,0x4208,0xF81F,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0x8410,
+0x4208,0xF81F,0xF800,0x8410,0x4208,0xF800,0xF800,0xF800,0xF800,0xF81F,0xF800,0xF800,0x1234,0xF800,0xF800,0xF800,
+0xF800,0xF800,0x1234,0x07E0,0x0000,0xF81F,0xF800,0x4208,0xF800,0xF800,0x8410,0x1234,0xF800,0xF800,0xF800,0xF800,
+0xF800,0xF800,0x07E0,0x07E0,0xF800,0xF800,0xF800,0x07E0,0xF81F,0x4208,0xF800,0x1234,0x4208,0xF800,0xF800,0xF800,
+0x1234,0xF800,0xFFE0,0xF800,0xFFE0,0xF800,0xFFFF,0x1234,0x4208,0x0000,0xF800,0xFFE0,0xF800,0xF800,0xF81F,0x001F,
+0xF800,0xFFFF,0x8410,0xFFE0,0xF800,0xF800,0xF800,0xFFE0,0xF800,0xF800,0xF800,0x07FF,0xFFFF,0xF800,0xF800,0x1234,
+0x07FF,0x07FF,0xFD20,0xFFE0,0xF800,0xF800,0xF81F,0x07E0,0xFFE0,0xF81F,0xF800,0xF800,0xF800,0x07FF,0xF800,0xF800,
+0x0000,0x001F,0xF800,0xF800,0x001F,0x1234,0xF800,0x8410,0xF81F,0xF800,0x001F,0xF81F,0xF800,0x4208,0xF800,0x001F,
+0x07FF,0xF800,0x07E0,0xF800,0xFFE0,0xF800,0xF81F,0xF800,0x4208,0xF800,0xF81F,0xF800,0x4208,0x07FF,0x1234,0xF800,
+0x0000,0x4208,0x4208,0x4208,0xF800,0xF800,0xF800,0xF800,0x001F,0xF800,0xF800,0x07E0,0xF800,0xF800,0x4208,0xF800,
+0x0000,0x001F,0x0000,0x8410,0xF800,0x07FF,0xFFFF,0xF800,0xF800,0x001F,0x8410,0x8410,0x07E0,0xF800,0x4208,0x8410,
+0xF800,0xF800,0xF800,0xF800,0x1234,0xF800,0xF800,0xFD20,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xFD20,
+0x07E0,0x07E0,0xF800,0xF800,0xF800,0x8410,0xF800,0xF800,0x07FF,0xFFFF,0xF800,0xF800,0xFFE0,0xF800,0xF800,0xFFE0,
+0x8410,0xF800,0xF800,0x8410,0xF800,0xF800,0xF800,0x8410,0xF800,0xF800,0xF800,0xF800,0x001F,0xFD20,0x1234,0x4208,
+0xF800,0x0000,0x0000,0xF800,0xF800,0xF800,0xF800,0x001F,0xF81F,0xF800,0x001F,0x1234,0xF800,0xF800,0xF800,0xFFFF,
+0xF800,0xF800,0x1234,0x4208,0xF800,0xF800,0x8410,0xF800,0xF800,0xF800,0xFD20,0xF800,0x0000,0xF800,0xF800,0xF800,
+0x1234,0xF800,0xFFE0,0xF800,0xF800,0xF800,0xF800,0x4208,0x4208,0xFFFF,0xF800,0x8410,0xF800,0xF800,0xF800,0xF800,
+};
@@ -0,0 +1,45 @@
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#elif defined(__PIC32MX__)
+	#define PROGMEM
+#elif defined(__arm__)
+	#define PROGMEM
+#endif
+
+// stripes_palette.c
+// Generated from	: stripes.h
+// Dimensions		: 40x20 pixels
+// Format			: BITMAP_PALETTE, 4 bpp, 12 colors
+// Memory usage	: 431 bytes (raw 1600 bytes)
+//
+// Draw with myGLCD.drawCompressedBitmap(x, y, stripes_palette);
+
+const unsigned char stripes_palette[431] PROGMEM={
+0x02,0x04,0x28,0x00,0x14,0x00,  // header
+0x0B,0x00,0x00,0x1F,0x00,0xE0,0x07,0xFF,0x07,0x34,0x12,0x08,0x42,0x10,0x84,0x00,0xF8,0x1F,0xF8,0x20,0xFD,0xE0,0xFF,0xFF,0xFF,  // palette
+0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,
+0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,
+0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,
+0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,
+0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,
+0x11,0x1A,0xAA,0x33,0x38,0x88,0x66,0x65,0x55,0x99,0x94,0x44,0x00,0x0B,0xBB,0x77,
+0x72,0x22,0x11,0x1A,0xAA,0xA3,0x33,0x88,0x86,0x66,0x55,0x59,0x99,0x44,0x40,0x00,
+0xBB,0xB7,0x77,0x22,0x21,0x11,0xAA,0xA3,0x33,0x38,0x88,0x66,0x65,0x55,0x99,0x94,
+0x44,0x00,0x0B,0xBB,0x77,0x72,0x22,0x11,0x1A,0xAA,0x33,0x38,0x88,0x86,0x66,0x55,
+0x59,0x99,0x44,0x40,0x00,0xBB,0xB7,0x77,0x22,0x21,0x11,0xAA,0xA3,0x33,0x88,0x86,
+0x66,0x65,0x55,0x99,0x94,0x44,0x00,0x0B,0xBB,0x77,0x72,0x22,0x11,0x1A,0xAA,0x33,
+0x38,0x88,0x66,0x65,0x55,0x59,0x99,0x44,0x40,0x00,0xBB,0xB7,0x77,0x22,0x21,0x11,
+0xAA,0xA3,0x33,0x88,0x86,0x66,0x55,0x59,0x99,0x94,0x44,0x00,0x0B,0xBB,0x77,0x72,
+0x22,0x11,0x1A,0xAA,0x33,0x38,0x88,0x66,0x65,0x55,0x99,0x94,0x44,0x40,0x00,0xBB,
+0xB7,0x77,0x22,0x21,0x11,0xAA,0xA3,0x33,0x88,0x86,0x66,0x55,0x59,0x99,0x44,0x40,
+0x77,0x77,0x17,0x77,0x7A,0x77,0x70,0x74,0x49,0x0A,0xAB,0xA7,0x77,0x47,0x73,0x75,
+0x76,0x77,0x77,0x73,0x29,0x57,0x57,0x9B,0x77,0x75,0x87,0x77,0x77,0x77,0x77,0x76,
+0x58,0x76,0x57,0x77,0x78,0x77,0x47,0x77,0x77,0x42,0x08,0x75,0x77,0x64,0x77,0x77,
+0x77,0x22,0x77,0x72,0x85,0x74,0x57,0x77,0x47,0xA7,0xA7,0xB4,0x50,0x7A,0x77,0x81,
+0x7B,0x6A,0x77,0x7A,0x77,0x73,0xB7,0x74,0x33,0x9A,0x77,0x82,0xA8,0x77,0x73,0x77,
+0x01,0x77,0x14,0x76,0x87,0x18,0x75,0x71,0x37,0x27,0xA7,0x87,0x57,0x87,0x53,0x47,
+0x05,0x55,0x77,0x77,0x17,0x72,0x77,0x57,0x01,0x06,0x73,0xB7,0x71,0x66,0x27,0x56,
+0x77,0x77,0x47,0x79,0x77,0x77,0x77,0x79,0x22,0x77,0x76,0x77,0x3B,0x77,0xA7,0x7A,
+0x67,0x76,0x77,0x76,0x77,0x77,0x19,0x45,0x70,0x07,0x77,0x71,0x87,0x14,0x77,0x7B,
+0x77,0x45,0x77,0x67,0x77,0x97,0x07,0x77,0x47,0xA7,0x77,0x75,0x5B,0x76,0x77,0x77,
+};
@@ -0,0 +1,53 @@
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#elif defined(__PIC32MX__)
+	#define PROGMEM
+#elif defined(__arm__)
+	#define PROGMEM
+#endif
+
+// stripes_palette_rle.c
+// Generated from	: stripes.h
+// Dimensions		: 40x20 pixels
+// Format			: BITMAP_PALETTE_RLE, 8 bpp, 12 colors
+// Memory usage	: 557 bytes (raw 1600 bytes)
+//
+// Draw with myGLCD.drawCompressedBitmap(x, y, stripes_palette_rle);
+
+const unsigned char stripes_palette_rle[557] PROGMEM={
+0x03,0x08,0x28,0x00,0x14,0x00,  // header
+0x0B,0x00,0x00,0x1F,0x00,0xE0,0x07,0xFF,0x07,0x34,0x12,0x08,0x42,0x10,0x84,0x00,0xF8,0x1F,0xF8,0x20,0xFD,0xE0,0xFF,0xFF,0xFF,  // palette
+0xFF,0x0B,0x9F,0x0B,0x82,0x01,0x82,0x0A,0x82,0x03,0x82,0x08,0x82,0x06,0x82,0x05,
+0x82,0x09,0x82,0x04,0x82,0x00,0x82,0x0B,0x82,0x07,0x82,0x02,0x82,0x01,0x83,0x0A,
+0x82,0x03,0x82,0x08,0x82,0x06,0x82,0x05,0x82,0x09,0x82,0x04,0x82,0x00,0x82,0x0B,
+0x82,0x07,0x82,0x02,0x82,0x01,0x82,0x0A,0x83,0x03,0x82,0x08,0x82,0x06,0x82,0x05,
+0x82,0x09,0x82,0x04,0x82,0x00,0x82,0x0B,0x82,0x07,0x82,0x02,0x82,0x01,0x82,0x0A,
+0x82,0x03,0x83,0x08,0x82,0x06,0x82,0x05,0x82,0x09,0x82,0x04,0x82,0x00,0x82,0x0B,
+0x82,0x07,0x82,0x02,0x82,0x01,0x82,0x0A,0x82,0x03,0x82,0x08,0x83,0x06,0x82,0x05,
+0x82,0x09,0x82,0x04,0x82,0x00,0x82,0x0B,0x82,0x07,0x82,0x02,0x82,0x01,0x82,0x0A,
+0x82,0x03,0x82,0x08,0x82,0x06,0x83,0x05,0x82,0x09,0x82,0x04,0x82,0x00,0x82,0x0B,
+0x82,0x07,0x82,0x02,0x82,0x01,0x82,0x0A,0x82,0x03,0x82,0x08,0x82,0x06,0x82,0x05,
+0x83,0x09,0x82,0x04,0x82,0x00,0x82,0x0B,0x82,0x07,0x82,0x02,0x82,0x01,0x82,0x0A,
+0x82,0x03,0x82,0x08,0x82,0x06,0x82,0x05,0x82,0x09,0x83,0x04,0x82,0x00,0x82,0x0B,
+0x82,0x07,0x82,0x02,0x82,0x01,0x82,0x0A,0x82,0x03,0x82,0x08,0x82,0x06,0x82,0x05,
+0x82,0x09,0x82,0x04,0x00,0x00,0x83,0x07,0x00,0x01,0x83,0x07,0x00,0x0A,0x82,0x07,
+0x01,0x00,0x07,0x81,0x04,0x01,0x09,0x00,0x81,0x0A,0x01,0x0B,0x0A,0x82,0x07,0x00,
+0x04,0x81,0x07,0x04,0x03,0x07,0x05,0x07,0x06,0x84,0x07,0x08,0x03,0x02,0x09,0x05,
+0x07,0x05,0x07,0x09,0x0B,0x82,0x07,0x01,0x05,0x08,0x89,0x07,0x05,0x06,0x05,0x08,
+0x07,0x06,0x05,0x83,0x07,0x00,0x08,0x81,0x07,0x00,0x04,0x84,0x07,0x05,0x04,0x02,
+0x00,0x08,0x07,0x05,0x81,0x07,0x01,0x06,0x04,0x85,0x07,0x81,0x02,0x82,0x07,0x05,
+0x02,0x08,0x05,0x07,0x04,0x05,0x82,0x07,0x0B,0x04,0x07,0x0A,0x07,0x0A,0x07,0x0B,
+0x04,0x05,0x00,0x07,0x0A,0x81,0x07,0x05,0x08,0x01,0x07,0x0B,0x06,0x0A,0x82,0x07,
+0x00,0x0A,0x82,0x07,0x01,0x03,0x0B,0x81,0x07,0x00,0x04,0x81,0x03,0x01,0x09,0x0A,
+0x81,0x07,0x03,0x08,0x02,0x0A,0x08,0x82,0x07,0x00,0x03,0x81,0x07,0x01,0x00,0x01,
+0x81,0x07,0x1C,0x01,0x04,0x07,0x06,0x08,0x07,0x01,0x08,0x07,0x05,0x07,0x01,0x03,
+0x07,0x02,0x07,0x0A,0x07,0x08,0x07,0x05,0x07,0x08,0x07,0x05,0x03,0x04,0x07,0x00,
+0x82,0x05,0x83,0x07,0x00,0x01,0x81,0x07,0x00,0x02,0x81,0x07,0x08,0x05,0x07,0x00,
+0x01,0x00,0x06,0x07,0x03,0x0B,0x81,0x07,0x00,0x01,0x81,0x06,0x03,0x02,0x07,0x05,
+0x06,0x83,0x07,0x00,0x04,0x81,0x07,0x00,0x09,0x86,0x07,0x00,0x09,0x81,0x02,0x82,
+0x07,0x00,0x06,0x81,0x07,0x01,0x03,0x0B,0x81,0x07,0x00,0x0A,0x81,0x07,0x01,0x0A,
+0x06,0x81,0x07,0x00,0x06,0x82,0x07,0x00,0x06,0x83,0x07,0x04,0x01,0x09,0x04,0x05,
+0x07,0x81,0x00,0x83,0x07,0x04,0x01,0x08,0x07,0x01,0x04,0x82,0x07,0x00,0x0B,0x81,
+0x07,0x01,0x04,0x05,0x81,0x07,0x00,0x06,0x82,0x07,0x02,0x09,0x07,0x00,0x82,0x07,
+0x02,0x04,0x07,0x0A,0x83,0x07,0x81,0x05,0x02,0x0B,0x07,0x06,0x83,0x07,
+};
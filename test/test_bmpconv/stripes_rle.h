@@ -0,0 +1,72 @@
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#elif defined(__PIC32MX__)
+	#define PROGMEM
+#elif defined(__arm__)
+	#define PROGMEM
+#endif
+
+// stripes_rle.c
+// Generated from	: stripes.h
+// Dimensions		: 40x20 pixels
+// Format			: BITMAP_RLE
+// Memory usage	: 850 bytes (raw 1600 bytes)
+//
+// Draw with myGLCD.drawCompressedBitmap(x, y, stripes_rle);
+
+const unsigned char stripes_rle[850] PROGMEM={
+0x01,0x10,0x28,0x00,0x14,0x00,  // header
+0xFF,0xFF,0xFF,0x9F,0xFF,0xFF,0x82,0x1F,0x00,0x82,0xE0,0xFF,0x82,0xFF,0x07,0x82,
+0x1F,0xF8,0x82,0x10,0x84,0x82,0x08,0x42,0x82,0x20,0xFD,0x82,0x34,0x12,0x82,0x00,
+0x00,0x82,0xFF,0xFF,0x82,0x00,0xF8,0x82,0xE0,0x07,0x82,0x1F,0x00,0x83,0xE0,0xFF,
+0x82,0xFF,0x07,0x82,0x1F,0xF8,0x82,0x10,0x84,0x82,0x08,0x42,0x82,0x20,0xFD,0x82,
+0x34,0x12,0x82,0x00,0x00,0x82,0xFF,0xFF,0x82,0x00,0xF8,0x82,0xE0,0x07,0x82,0x1F,
+0x00,0x82,0xE0,0xFF,0x83,0xFF,0x07,0x82,0x1F,0xF8,0x82,0x10,0x84,0x82,0x08,0x42,
+0x82,0x20,0xFD,0x82,0x34,0x12,0x82,0x00,0x00,0x82,0xFF,0xFF,0x82,0x00,0xF8,0x82,
+0xE0,0x07,0x82,0x1F,0x00,0x82,0xE0,0xFF,0x82,0xFF,0x07,0x83,0x1F,0xF8,0x82,0x10,
+0x84,0x82,0x08,0x42,0x82,0x20,0xFD,0x82,0x34,0x12,0x82,0x00,0x00,0x82,0xFF,0xFF,
+0x82,0x00,0xF8,0x82,0xE0,0x07,0x82,0x1F,0x00,0x82,0xE0,0xFF,0x82,0xFF,0x07,0x82,
+0x1F,0xF8,0x83,0x10,0x84,0x82,0x08,0x42,0x82,0x20,0xFD,0x82,0x34,0x12,0x82,0x00,
+0x00,0x82,0xFF,0xFF,0x82,0x00,0xF8,0x82,0xE0,0x07,0x82,0x1F,0x00,0x82,0xE0,0xFF,
+0x82,0xFF,0x07,0x82,0x1F,0xF8,0x82,0x10,0x84,0x83,0x08,0x42,0x82,0x20,0xFD,0x82,
+0x34,0x12,0x82,0x00,0x00,0x82,0xFF,0xFF,0x82,0x00,0xF8,0x82,0xE0,0x07,0x82,0x1F,
+0x00,0x82,0xE0,0xFF,0x82,0xFF,0x07,0x82,0x1F,0xF8,0x82,0x10,0x84,0x82,0x08,0x42,
+0x83,0x20,0xFD,0x82,0x34,0x12,0x82,0x00,0x00,0x82,0xFF,0xFF,0x82,0x00,0xF8,0x82,
+0xE0,0x07,0x82,0x1F,0x00,0x82,0xE0,0xFF,0x82,0xFF,0x07,0x82,0x1F,0xF8,0x82,0x10,
+0x84,0x82,0x08,0x42,0x82,0x20,0xFD,0x83,0x34,0x12,0x82,0x00,0x00,0x82,0xFF,0xFF,
+0x82,0x00,0xF8,0x82,0xE0,0x07,0x82,0x1F,0x00,0x82,0xE0,0xFF,0x82,0xFF,0x07,0x82,
+0x1F,0xF8,0x82,0x10,0x84,0x82,0x08,0x42,0x82,0x20,0xFD,0x82,0x34,0x12,0x00,0x00,
+0x00,0x83,0x00,0xF8,0x00,0x1F,0x00,0x83,0x00,0xF8,0x00,0xE0,0xFF,0x82,0x00,0xF8,
+0x01,0x00,0x00,0x00,0xF8,0x81,0x34,0x12,0x01,0x20,0xFD,0x00,0x00,0x81,0xE0,0xFF,
+0x01,0xFF,0xFF,0xE0,0xFF,0x82,0x00,0xF8,0x00,0x34,0x12,0x81,0x00,0xF8,0x04,0xFF,
+0x07,0x00,0xF8,0x08,0x42,0x00,0xF8,0x10,0x84,0x84,0x00,0xF8,0x08,0xFF,0x07,0xE0,
+0x07,0x20,0xFD,0x08,0x42,0x00,0xF8,0x08,0x42,0x00,0xF8,0x20,0xFD,0xFF,0xFF,0x82,
+0x00,0xF8,0x01,0x08,0x42,0x1F,0xF8,0x89,0x00,0xF8,0x05,0x10,0x84,0x08,0x42,0x1F,
+0xF8,0x00,0xF8,0x10,0x84,0x08,0x42,0x83,0x00,0xF8,0x00,0x1F,0xF8,0x81,0x00,0xF8,
+0x00,0x34,0x12,0x84,0x00,0xF8,0x05,0x34,0x12,0xE0,0x07,0x00,0x00,0x1F,0xF8,0x00,
+0xF8,0x08,0x42,0x81,0x00,0xF8,0x01,0x10,0x84,0x34,0x12,0x85,0x00,0xF8,0x81,0xE0,
+0x07,0x82,0x00,0xF8,0x05,0xE0,0x07,0x1F,0xF8,0x08,0x42,0x00,0xF8,0x34,0x12,0x08,
+0x42,0x82,0x00,0xF8,0x0B,0x34,0x12,0x00,0xF8,0xE0,0xFF,0x00,0xF8,0xE0,0xFF,0x00,
+0xF8,0xFF,0xFF,0x34,0x12,0x08,0x42,0x00,0x00,0x00,0xF8,0xE0,0xFF,0x81,0x00,0xF8,
+0x05,0x1F,0xF8,0x1F,0x00,0x00,0xF8,0xFF,0xFF,0x10,0x84,0xE0,0xFF,0x82,0x00,0xF8,
+0x00,0xE0,0xFF,0x82,0x00,0xF8,0x01,0xFF,0x07,0xFF,0xFF,0x81,0x00,0xF8,0x00,0x34,
+0x12,0x81,0xFF,0x07,0x01,0x20,0xFD,0xE0,0xFF,0x81,0x00,0xF8,0x03,0x1F,0xF8,0xE0,
+0x07,0xE0,0xFF,0x1F,0xF8,0x82,0x00,0xF8,0x00,0xFF,0x07,0x81,0x00,0xF8,0x01,0x00,
+0x00,0x1F,0x00,0x81,0x00,0xF8,0x1C,0x1F,0x00,0x34,0x12,0x00,0xF8,0x10,0x84,0x1F,
+0xF8,0x00,0xF8,0x1F,0x00,0x1F,0xF8,0x00,0xF8,0x08,0x42,0x00,0xF8,0x1F,0x00,0xFF,
+0x07,0x00,0xF8,0xE0,0x07,0x00,0xF8,0xE0,0xFF,0x00,0xF8,0x1F,0xF8,0x00,0xF8,0x08,
+0x42,0x00,0xF8,0x1F,0xF8,0x00,0xF8,0x08,0x42,0xFF,0x07,0x34,0x12,0x00,0xF8,0x00,
+0x00,0x82,0x08,0x42,0x83,0x00,0xF8,0x00,0x1F,0x00,0x81,0x00,0xF8,0x00,0xE0,0x07,
+0x81,0x00,0xF8,0x08,0x08,0x42,0x00,0xF8,0x00,0x00,0x1F,0x00,0x00,0x00,0x10,0x84,
+0x00,0xF8,0xFF,0x07,0xFF,0xFF,0x81,0x00,0xF8,0x00,0x1F,0x00,0x81,0x10,0x84,0x03,
+0xE0,0x07,0x00,0xF8,0x08,0x42,0x10,0x84,0x83,0x00,0xF8,0x00,0x34,0x12,0x81,0x00,
+0xF8,0x00,0x20,0xFD,0x86,0x00,0xF8,0x00,0x20,0xFD,0x81,0xE0,0x07,0x82,0x00,0xF8,
+0x00,0x10,0x84,0x81,0x00,0xF8,0x01,0xFF,0x07,0xFF,0xFF,0x81,0x00,0xF8,0x00,0xE0,
+0xFF,0x81,0x00,0xF8,0x01,0xE0,0xFF,0x10,0x84,0x81,0x00,0xF8,0x00,0x10,0x84,0x82,
+0x00,0xF8,0x00,0x10,0x84,0x83,0x00,0xF8,0x04,0x1F,0x00,0x20,0xFD,0x34,0x12,0x08,
+0x42,0x00,0xF8,0x81,0x00,0x00,0x83,0x00,0xF8,0x04,0x1F,0x00,0x1F,0xF8,0x00,0xF8,
+0x1F,0x00,0x34,0x12,0x82,0x00,0xF8,0x00,0xFF,0xFF,0x81,0x00,0xF8,0x01,0x34,0x12,
+0x08,0x42,0x81,0x00,0xF8,0x00,0x10,0x84,0x82,0x00,0xF8,0x02,0x20,0xFD,0x00,0xF8,
+0x00,0x00,0x82,0x00,0xF8,0x02,0x34,0x12,0x00,0xF8,0xE0,0xFF,0x83,0x00,0xF8,0x81,
+0x08,0x42,0x02,0xFF,0xFF,0x00,0xF8,0x10,0x84,0x83,0x00,0xF8,
+};
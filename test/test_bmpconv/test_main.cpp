@@ -0,0 +1,142 @@
+// Checks that drawCompressedBitmap() draws what Tools/bmpconv.py encoded.
+// The raw images are RGB565 arrays in the ImageConverter 565 layout, the
+// others are bmpconv.py's output for them, made with e.g.
+//
+//   bmpconv.py stripes.h --format palette-rle --name stripes_palette_rle -o stripes_palette_rle.h
+//
+// Each one is drawn over a known background and compared pixel for pixel
+// with its raw image. Bitmaps with an unknown format or bits per pixel
+// must not draw anything.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_Host.h>
+
+#include "stripes.h"
+#include "stripes_rle.h"
+#include "stripes_palette.h"
+#include "stripes_palette_rle.h"
+#include "mono.h"
+#include "mono_palette.h"
+#include "four.h"
+#include "four_palette.h"
+#include "gradient.h"
+#include "gradient_palette.h"
+
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS		40
+#define LCD_RST		41
+
+#define BACKGROUND	0x5AA5
+
+static HostPanel	*panel;
+static UTFT			*lcd;
+static boolean		rotated;	// LANDSCAPE without memory access control
+
+static void open(byte model, byte orientation)
+{
+	host_reset();
+	panel = new HostPanel(320, 480, HOST_BUS_16, LCD_CS, LCD_RS, LCD_WR);
+	lcd = new UTFT(model, LCD_RS, LCD_WR, LCD_CS, LCD_RST);
+	lcd->InitLCD(orientation);
+	rotated = (lcd->orient==LANDSCAPE);
+}
+
+// Reads back logical (x,y)
+static word at(int x, int y)
+{
+	if (rotated)
+		return panel->pixel(y, 479-x);
+	return panel->pixel(x, y);
+}
+
+static void check(int x, int y, const uint8_t *data, const unsigned short *raw, int sx, int sy, const char *what)
+{
+	word	want;
+
+	lcd->fillScr(BACKGROUND);
+	panel->clearCounts();
+	lcd->drawCompressedBitmap(x, y, data);
+	TEST_ASSERT_EQUAL_MESSAGE(long(sx)*sy, panel->pixels, what);
+	for (int ty=-1; ty<=sy; ty++)
+		for (int tx=-1; tx<=sx; tx++)
+		{
+			if ((tx<0) or (ty<0) or (tx>=sx) or (ty>=sy))
+				want = BACKGROUND;
+			else
+				want = raw[ty*sx+tx];
+			TEST_ASSERT_EQUAL_MESSAGE(want, at(x+tx, y+ty), what);
+		}
+}
+
+static void check_all()
+{
+	check(3, 5, stripes_rle, stripes, 40, 20, "BITMAP_RLE");
+	check(3, 5, stripes_palette, stripes, 40, 20, "BITMAP_PALETTE 4 bpp");
+	check(3, 5, stripes_palette_rle, stripes, 40, 20, "BITMAP_PALETTE_RLE");
+	check(100, 7, mono_palette, mono, 21, 9, "BITMAP_PALETTE 1 bpp");
+	check(1, 1, four_palette, four, 13, 5, "BITMAP_PALETTE 2 bpp");
+	check(50, 60, gradient_palette, gradient, 30, 10, "BITMAP_PALETTE 8 bpp");
+}
+
+void setUp()
+{
+	panel = NULL;
+	lcd = NULL;
+}
+
+void tearDown()
+{
+	delete lcd;
+	delete panel;
+}
+
+void test_portrait()
+{
+	open(ILI9486, PORTRAIT);
+	check_all();
+}
+
+void test_madctl_landscape()
+{
+	open(ILI9486, LANDSCAPE);
+	TEST_ASSERT_FALSE(rotated);
+	check_all();
+}
+
+// One window per row, sent right to left into a panel column
+void test_landscape()
+{
+	open(ILI9488, LANDSCAPE);
+	TEST_ASSERT_TRUE(rotated);
+	check_all();
+}
+
+void test_unknown()
+{
+	static const uint8_t	bad[][BITMAP_HEADER_SIZE+3] PROGMEM = {
+		{0, 16, 1, 0, 1, 0, 0x00, 0xFF, 0xFF},
+		{4, 16, 1, 0, 1, 0, 0x00, 0xFF, 0xFF},
+		{BITMAP_RLE, 8, 1, 0, 1, 0, 0x00, 0xFF, 0xFF},
+		{BITMAP_PALETTE, 3, 1, 0, 1, 0, 0x00, 0xFF, 0xFF},
+		{BITMAP_PALETTE, 16, 1, 0, 1, 0, 0x00, 0xFF, 0xFF},
+		{BITMAP_PALETTE_RLE, 4, 1, 0, 1, 0, 0x00, 0xFF, 0xFF},
+	};
+
+	open(ILI9486, PORTRAIT);
+	panel->clearCounts();
+	for (byte i=0; i<sizeof(bad)/sizeof(bad[0]); i++)
+		lcd->drawCompressedBitmap(0, 0, bad[i]);
+	TEST_ASSERT_EQUAL(0, panel->edges);
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_portrait);
+	RUN_TEST(test_madctl_landscape);
+	RUN_TEST(test_landscape);
+	RUN_TEST(test_unknown);
+	return UNITY_END();
+}
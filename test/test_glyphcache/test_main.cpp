@@ -0,0 +1,179 @@
+// Checks UTFT_GlyphCache against UTFT::print(). Two modules of the same
+// model share the data bus, each with its own control pins: one prints
+// through the cache, the other through UTFT, and their frames must be
+// identical after every hit, miss, eviction and fallback.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_GlyphCache.h>
+#include <UTFT_Host.h>
+
+extern uint8_t SmallFont[];
+extern uint8_t BigFont[];
+extern uint8_t SevenSeg_XXXL_Num[];
+
+#define REF_RS		38
+#define REF_WR		39
+#define REF_CS		40
+#define REF_RST		41
+#define CACHE_RS	42
+#define CACHE_WR	43
+#define CACHE_CS	44
+#define CACHE_RST	45
+
+static HostPanel		*ref_panel, *cache_panel;
+static UTFT				*ref, *lcd;
+static UTFT_GlyphCache	*glyphs;
+
+static void open(byte model, byte orientation)
+{
+	host_reset();
+	ref_panel = new HostPanel(320, 480, HOST_BUS_16, REF_CS, REF_RS, REF_WR);
+	cache_panel = new HostPanel(320, 480, HOST_BUS_16, CACHE_CS, CACHE_RS, CACHE_WR);
+	ref = new UTFT(model, REF_RS, REF_WR, REF_CS, REF_RST);
+	lcd = new UTFT(model, CACHE_RS, CACHE_WR, CACHE_CS, CACHE_RST);
+	ref->InitLCD(orientation);
+	lcd->InitLCD(orientation);
+	ref->setFont(BigFont);
+	lcd->setFont(BigFont);
+	glyphs = new UTFT_GlyphCache(lcd);
+}
+
+static void check_frames(const char *what)
+{
+	TEST_ASSERT_TRUE_MESSAGE(cache_panel->pixels>0, what);
+	for (int y=0; y<480; y++)
+		for (int x=0; x<320; x++)
+			if (ref_panel->pixel(x, y)!=cache_panel->pixel(x, y))
+				TEST_ASSERT_EQUAL_MESSAGE(ref_panel->pixel(x, y), cache_panel->pixel(x, y), what);
+}
+
+// Prints st both ways and checks the counters moved by hits and misses
+static void print(const char *st, int x, int y, unsigned long hits, unsigned long misses)
+{
+	char	buf[32];
+
+	strcpy(buf, st);
+	glyphs->resetStats();
+	cache_panel->clearCounts();
+	glyphs->print(st, x, y);
+	ref->print(buf, x, y);
+	check_frames(st);
+	TEST_ASSERT_EQUAL_MESSAGE(hits, glyphs->getHits(), st);
+	TEST_ASSERT_EQUAL_MESSAGE(misses, glyphs->getMisses(), st);
+}
+
+static void check_cache()
+{
+	print("RED TEAM:", 10, 20, 1, 8);		// E twice
+	print("RED TEAM:", 10, 20, 9, 0);
+	print("BLUE TEAM:", 10, 60, 7, 3);		// B, L and U are new
+
+	// Another color is another entry
+	ref->setColor(VGA_RED);
+	lcd->setColor(VGA_RED);
+	ref->setBackColor(VGA_BLUE);
+	lcd->setBackColor(VGA_BLUE);
+	print("RED", 10, 100, 0, 3);
+	print("RED", 10, 100, 3, 0);
+}
+
+void setUp()
+{
+	ref_panel = cache_panel = NULL;
+	ref = lcd = NULL;
+	glyphs = NULL;
+}
+
+void tearDown()
+{
+	delete glyphs;
+	delete ref;
+	delete lcd;
+	delete ref_panel;
+	delete cache_panel;
+}
+
+void test_landscape()
+{
+	open(ILI9486, LANDSCAPE);
+	check_cache();
+}
+
+void test_portrait()
+{
+	open(ILI9486, PORTRAIT);
+	check_cache();
+}
+
+// Decoded for a controller that is not rotated in hardware
+void test_landscape_unrotated()
+{
+	open(ILI9488, LANDSCAPE);
+	check_cache();
+}
+
+// One character more than there are slots pushes out the least recently
+// used one, the first
+void test_eviction()
+{
+	char	st[GLYPHCACHE_SLOTS+2];
+
+	open(ILI9486, LANDSCAPE);
+	for (int i=0; i<=GLYPHCACHE_SLOTS; i++)
+		st[i] = 'A'+i;
+	st[GLYPHCACHE_SLOTS+1] = 0;
+	print(st, 0, 0, 0, GLYPHCACHE_SLOTS+1);
+	print(&st[GLYPHCACHE_SLOTS], 0, 40, 1, 0);
+	st[1] = 0;
+	print(st, 0, 80, 0, 1);
+}
+
+// 100 rows don't fit in a slot, so UTFT draws them
+void test_too_big()
+{
+	open(ILI9486, LANDSCAPE);
+	ref->setFont(SevenSeg_XXXL_Num);
+	lcd->setFont(SevenSeg_XXXL_Num);
+	print("42", 0, 0, 0, 2);
+	print("42", 0, 0, 0, 2);
+}
+
+// With a transparent background nothing is cached
+void test_transparent()
+{
+	open(ILI9486, LANDSCAPE);
+	ref->setBackColor(VGA_TRANSPARENT);
+	lcd->setBackColor(VGA_TRANSPARENT);
+	print("RED", 0, 0, 0, 0);
+}
+
+// A different font or orientation is not a hit. The ILI9488 is not
+// rotated in hardware, so its characters are sent in another order in
+// each orientation.
+void test_font_and_orientation()
+{
+	open(ILI9488, LANDSCAPE);
+	print("RED", 0, 0, 0, 3);
+	ref->setFont(SmallFont);
+	lcd->setFont(SmallFont);
+	print("RED", 0, 40, 0, 3);
+	ref->InitLCD(PORTRAIT);
+	lcd->InitLCD(PORTRAIT);
+	ref->setFont(SmallFont);
+	lcd->setFont(SmallFont);
+	print("RED", 0, 40, 0, 3);
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_landscape);
+	RUN_TEST(test_portrait);
+	RUN_TEST(test_landscape_unrotated);
+	RUN_TEST(test_eviction);
+	RUN_TEST(test_too_big);
+	RUN_TEST(test_transparent);
+	RUN_TEST(test_font_and_orientation);
+	return UNITY_END();
+}
@@ -0,0 +1,174 @@
+// Checks that the ILI9486 init table sends what the hand-written init
+// sequence did, command for command and parameter for parameter. The
+// expected stream below is that sequence as it was in
+// tft_drivers/ili9486/initlcd.h, except for Memory Access Control. That
+// is now sent last, with the value for the orientation. Started with
+// beginInitLCD() and polled with updateInitLCD(), the same stream must go
+// out, with nothing sent or drawn before its wait is over.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_Host.h>
+
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS		40
+#define LCD_RST		41
+
+#define C(v)		(v)					// LCD_Write_COM(v)
+#define D(v)		(0x10000UL | (v))	// LCD_Write_DATA(v)
+
+static const unsigned long	initlcd[] = {
+	C(0x11),							// Sleep OUT
+	C(0xF2), D(0x1C), D(0xA3), D(0x32), D(0x02), D(0xB2), D(0x12), D(0xFF), D(0x12), D(0x00),
+	C(0xF1), D(0x36), D(0xA4),
+	C(0xF8), D(0x21), D(0x04),
+	C(0xF9), D(0x00), D(0x08),
+	C(0xC0), D(0x0D), D(0x0D),			// Power Control 1
+	C(0xC1), D(0x43), D(0x00),			// Power Control 2
+	C(0xC2), D(0x00),					// Power Control 3
+	C(0xC5), D(0x00), D(0x48),			// VCOM Control
+	C(0xB6), D(0x00), D(0x22), D(0x3B),	// Display Function Control
+	C(0xE0), D(0x0F), D(0x24), D(0x1C), D(0x0A), D(0x0F), D(0x08), D(0x43), D(0x88),
+		D(0x32), D(0x0F), D(0x10), D(0x06), D(0x0F), D(0x07), D(0x00),
+	C(0xE1), D(0x0F), D(0x38), D(0x30), D(0x09), D(0x0F), D(0x0F), D(0x4E), D(0x77),
+		D(0x3C), D(0x07), D(0x10), D(0x05), D(0x23), D(0x1B), D(0x00),
+	C(0x20), D(0x00),					// Display Inversion OFF
+	C(0x3A), D(0x55),					// Interface Pixel Format
+	C(0x2A), D(0x00), D(0x00), D(0x01), D(0xDF),
+	C(0x2B), D(0x00), D(0x00), D(0x01), D(0x3F),
+	C(0x29),							// Display ON
+	C(0x2C),							// Memory Write
+};
+
+#define INITLCD_SIZE	(sizeof(initlcd)/sizeof(initlcd[0]))
+
+static HostPanel	*panel;
+static UTFT			*lcd;
+
+static void check(byte orientation, byte madctl)
+{
+	unsigned long	start = millis();
+	char			msg[32];
+
+	lcd->InitLCD(orientation);
+	TEST_ASSERT_TRUE(lcd->ready());
+	TEST_ASSERT_EQUAL(INITLCD_SIZE+2, panel->stream.size());
+	for (size_t i=0; i<INITLCD_SIZE; i++)
+	{
+		snprintf(msg, sizeof(msg), "write %d", int(i));
+		TEST_ASSERT_EQUAL_HEX32_MESSAGE(initlcd[i], panel->stream[i], msg);
+	}
+	TEST_ASSERT_EQUAL_HEX32(C(0x36), panel->stream[INITLCD_SIZE]);
+	TEST_ASSERT_EQUAL_HEX32(D(madctl), panel->stream[INITLCD_SIZE+1]);
+	TEST_ASSERT_EQUAL(madctl, panel->madctl);
+
+	// 120ms after reset and 5ms after Sleep Out, not the 700ms it was
+	TEST_ASSERT_EQUAL(125, millis()-start);
+}
+
+void setUp()
+{
+	host_reset();
+	panel = new HostPanel(320, 480, HOST_BUS_16, LCD_CS, LCD_RS, LCD_WR);
+	lcd = new UTFT(ILI9486, LCD_RS, LCD_WR, LCD_CS, LCD_RST);
+}
+
+void tearDown()
+{
+	delete lcd;
+	delete panel;
+}
+
+// Polls updateInitLCD() every millisecond until the display is ready
+static std::vector<unsigned long> poll(byte orientation)
+{
+	std::vector<unsigned long>	sent;
+	unsigned long				start = millis();
+
+	lcd->beginInitLCD(orientation);
+	TEST_ASSERT_EQUAL(0, panel->stream.size());
+	while (!lcd->updateInitLCD())
+	{
+		TEST_ASSERT_FALSE(lcd->ready());
+		TEST_ASSERT_TRUE(millis()-start<1000);
+		host_advance(1);
+	}
+	TEST_ASSERT_TRUE(lcd->ready());
+	sent = panel->stream;
+	return sent;
+}
+
+static void reopen()
+{
+	tearDown();
+	setUp();
+}
+
+void test_portrait()
+{
+	check(PORTRAIT, 0x0A);
+}
+
+void test_landscape()
+{
+	check(LANDSCAPE, 0x6A);
+}
+
+void test_async()
+{
+	std::vector<unsigned long>	sent;
+	byte						o;
+
+	for (o=PORTRAIT; o<=LANDSCAPE; o++)
+	{
+		sent = poll(o);
+		reopen();
+		lcd->InitLCD(o);
+		TEST_ASSERT_TRUE(sent==panel->stream);
+		reopen();
+	}
+}
+
+// Nothing goes out before a wait is over, and drawing is ignored until
+// the last command has been sent
+void test_waits()
+{
+	lcd->beginInitLCD(PORTRAIT);
+	lcd->setColor(VGA_RED);
+	lcd->fillScr(VGA_BLUE);
+	TEST_ASSERT_FALSE(lcd->updateInitLCD());
+	TEST_ASSERT_EQUAL(0, panel->stream.size());
+
+	host_advance(119);
+	TEST_ASSERT_FALSE(lcd->updateInitLCD());
+	TEST_ASSERT_EQUAL(0, panel->stream.size());
+	host_advance(1);
+	TEST_ASSERT_FALSE(lcd->updateInitLCD());
+	TEST_ASSERT_EQUAL(1, panel->stream.size());
+	TEST_ASSERT_EQUAL_HEX32(C(0x11), panel->stream[0]);
+
+	host_advance(4);
+	TEST_ASSERT_FALSE(lcd->updateInitLCD());
+	lcd->drawPixel(0, 0);
+	TEST_ASSERT_EQUAL(1, panel->stream.size());
+	host_advance(1);
+	TEST_ASSERT_TRUE(lcd->updateInitLCD());
+	TEST_ASSERT_EQUAL(INITLCD_SIZE+2, panel->stream.size());
+
+	// Once ready, polling sends nothing more
+	TEST_ASSERT_TRUE(lcd->updateInitLCD());
+	TEST_ASSERT_EQUAL(INITLCD_SIZE+2, panel->stream.size());
+	lcd->drawPixel(0, 0);
+	TEST_ASSERT_EQUAL(VGA_RED, panel->pixel(0, 0));
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_portrait);
+	RUN_TEST(test_landscape);
+	RUN_TEST(test_async);
+	RUN_TEST(test_waits);
+	return UNITY_END();
+}
@@ -0,0 +1,105 @@
+// Checks UTFT_Multi with two modules on one bus: InitLCD() must get both
+// modules ready only if the first one is, mirrored drawing must reach
+// both and drawing on one module must leave the other alone.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_Multi.h>
+#include <UTFT_Host.h>
+
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS1		40
+#define LCD_CS2		42
+#define LCD_RST		41
+
+#define NO_MODEL	250
+
+static HostPanel	*panel1, *panel2;
+static UTFT			*lcd1, *lcd2;
+static UTFT_Multi	*multi;
+
+static void open(byte model)
+{
+	panel1 = new HostPanel(320, 480, HOST_BUS_16, LCD_CS1, LCD_RS, LCD_WR);
+	panel2 = new HostPanel(320, 480, HOST_BUS_16, LCD_CS2, LCD_RS, LCD_WR);
+	lcd1 = new UTFT(model, LCD_RS, LCD_WR, LCD_CS1, LCD_RST);
+	lcd2 = new UTFT(model, LCD_RS, LCD_WR, LCD_CS2, LCD_RST);
+	multi = new UTFT_Multi();
+	multi->addPanel(lcd1);
+	multi->addPanel(lcd2);
+}
+
+void setUp()
+{
+	host_reset();
+	panel1 = panel2 = NULL;
+	lcd1 = lcd2 = NULL;
+	multi = NULL;
+}
+
+void tearDown()
+{
+	delete multi;
+	delete lcd2;
+	delete lcd1;
+	delete panel2;
+	delete panel1;
+}
+
+void test_init()
+{
+	open(ILI9486);
+	multi->InitLCD(PORTRAIT);
+	TEST_ASSERT_TRUE(lcd1->ready());
+	TEST_ASSERT_TRUE(lcd2->ready());
+	TEST_ASSERT_GREATER_THAN(0, panel1->stream.size());
+	TEST_ASSERT_TRUE(panel1->stream==panel2->stream);
+	TEST_ASSERT_EQUAL(lcd1->getDisplayXSize(), lcd2->getDisplayXSize());
+	TEST_ASSERT_EQUAL(lcd1->getDisplayYSize(), lcd2->getDisplayYSize());
+}
+
+// Without a driver for the model the first module is never ready, and
+// neither are the others
+void test_no_driver()
+{
+	open(NO_MODEL);
+	multi->InitLCD(PORTRAIT);
+	TEST_ASSERT_FALSE(lcd1->ready());
+	TEST_ASSERT_FALSE(lcd2->ready());
+	lcd2->fillScr(VGA_RED);
+	TEST_ASSERT_EQUAL(0, panel1->edges);
+	TEST_ASSERT_EQUAL(0, panel2->edges);
+}
+
+void test_mirror()
+{
+	UTFT	*all;
+
+	open(ILI9486);
+	multi->InitLCD(PORTRAIT);
+	all = multi->beginMirror();
+	all->setColor(VGA_RED);
+	all->fillRect(10, 20, 30, 40);
+	multi->endMirror();
+	TEST_ASSERT_EQUAL(VGA_RED, panel1->pixel(10, 20));
+	TEST_ASSERT_EQUAL(VGA_RED, panel2->pixel(30, 40));
+
+	lcd2->setColor(VGA_BLUE);
+	lcd2->fillRect(10, 20, 30, 40);
+	TEST_ASSERT_EQUAL(VGA_RED, panel1->pixel(10, 20));
+	TEST_ASSERT_EQUAL(VGA_BLUE, panel2->pixel(10, 20));
+	lcd1->setColor(VGA_GREEN);
+	lcd1->drawPixel(30, 40);
+	TEST_ASSERT_EQUAL(VGA_GREEN, panel1->pixel(30, 40));
+	TEST_ASSERT_EQUAL(VGA_BLUE, panel2->pixel(30, 40));
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_init);
+	RUN_TEST(test_no_driver);
+	RUN_TEST(test_mirror);
+	return UNITY_END();
+}
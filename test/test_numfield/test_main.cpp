@@ -0,0 +1,81 @@
+// Checks that UTFT_NumField only redraws the cells that changed, and that
+// it works when no font was set before.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_NumField.h>
+#include <UTFT_Host.h>
+
+extern uint8_t SmallFont[];
+extern uint8_t BigFont[];
+
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS		40
+#define LCD_RST		41
+
+static HostPanel	*panel;
+static UTFT			*lcd;
+
+void setUp()
+{
+	host_reset();
+	panel = new HostPanel(320, 480, HOST_BUS_16, LCD_CS, LCD_RS, LCD_WR);
+	lcd = new UTFT(ILI9486, LCD_RS, LCD_WR, LCD_CS, LCD_RST);
+	lcd->InitLCD(LANDSCAPE);
+}
+
+void tearDown()
+{
+	delete lcd;
+	delete panel;
+}
+
+void test_cells()
+{
+	UTFT_NumField	field(lcd, 10, 10, BigFont, 4);
+
+	lcd->setFont(SmallFont);
+	field.set(1234);
+	TEST_ASSERT_EQUAL(4, field.getLastCells());
+	TEST_ASSERT_EQUAL(4*16*16, field.getLastPixelEstimate());
+	TEST_ASSERT_EQUAL(8, lcd->getFontXsize());
+
+	panel->clearCounts();
+	field.set(1239);
+	TEST_ASSERT_EQUAL(1, field.getLastCells());
+	TEST_ASSERT_EQUAL(16*16, panel->pixels);
+	TEST_ASSERT_EQUAL(panel->pixels, field.getLastPixelEstimate());
+
+	// Two cells cleared
+	panel->clearCounts();
+	field.set(12);
+	TEST_ASSERT_EQUAL(2, field.getLastCells());
+	TEST_ASSERT_EQUAL(2*16*16, panel->pixels);
+
+	// Doesn't fit, shown as 9999
+	field.set(123456);
+	TEST_ASSERT_EQUAL(4, field.getLastCells());
+	field.set(-5);
+	TEST_ASSERT_EQUAL(4, field.getLastCells());
+	TEST_ASSERT_EQUAL(-5, field.get());
+}
+
+// The font in use is put back afterwards, unless there was none
+void test_no_font()
+{
+	UTFT_NumField	field(lcd, 10, 10, BigFont, 2);
+
+	TEST_ASSERT_TRUE(lcd->getFontAddress()==0);
+	field.set(42);
+	TEST_ASSERT_EQUAL(2, field.getLastCells());
+	TEST_ASSERT_EQUAL(16, lcd->getFontXsize());
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_cells);
+	RUN_TEST(test_no_font);
+	return UNITY_END();
+}
@@ -0,0 +1,111 @@
+// Checks printNumFixed() pixel for pixel against printNumF() of the same
+// value, over sign, decimals, length, filler, divider and alignment. Both
+// must also send the same number of pixels.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_Host.h>
+#include <stdio.h>
+
+extern uint8_t BigFont[];
+
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS		40
+#define LCD_RST		41
+
+#define TEXT_W		480
+#define TEXT_H		16
+
+// long is 32 bits on the AVR, so this is where printNumFixed() has to negate
+// a value that doesn't fit once positive
+#define AVR_LONG_MIN	(-2147483647L-1)
+
+static HostPanel	*panel;
+static UTFT			*lcd;
+
+static word			want[TEXT_W*TEXT_H], got[TEXT_W*TEXT_H];
+
+static void snapshot(word *buf)
+{
+	for (int y=0; y<TEXT_H; y++)
+		for (int x=0; x<TEXT_W; x++)
+			buf[y*TEXT_W+x] = panel->pixel(x, y);
+}
+
+static void check(long num, byte dec, int x, char divider, int length, char filler)
+{
+	double			scale = 1;
+	unsigned long	pixels;
+	char			msg[64];
+
+	for (byte i=0; i<dec; i++)
+		scale*=10;
+	snprintf(msg, sizeof(msg), "%ld dec %d x %d '%c' length %d '%c'", num, dec, x, divider, length, filler);
+
+	lcd->clrScr();
+	panel->clearCounts();
+	lcd->printNumF(num/scale, dec, x, 0, divider, length, filler);
+	pixels = panel->pixels;
+	snapshot(want);
+
+	lcd->clrScr();
+	panel->clearCounts();
+	lcd->printNumFixed(num, dec, x, 0, divider, length, filler);
+	snapshot(got);
+
+	TEST_ASSERT_EQUAL_MESSAGE(pixels, panel->pixels, msg);
+	TEST_ASSERT_EQUAL_MESSAGE(0, memcmp(want, got, sizeof(want)), msg);
+}
+
+void setUp()
+{
+	host_reset();
+	panel = new HostPanel(320, 480, HOST_BUS_16, LCD_CS, LCD_RS, LCD_WR);
+	lcd = new UTFT(ILI9486, LCD_RS, LCD_WR, LCD_CS, LCD_RST);
+	lcd->InitLCD(LANDSCAPE);
+	lcd->setFont(BigFont);
+	lcd->setColor(VGA_WHITE);
+	lcd->setBackColor(VGA_BLUE);
+}
+
+void tearDown()
+{
+	delete lcd;
+	delete panel;
+}
+
+// Zero, values between -1 and 0, both ends of the range and ordinary ones
+void test_values()
+{
+	static const long	nums[] = {0, 5, -5, -1, -99999, 99999, 100000, 12345, -12345, 7, -7, 2147483647L, AVR_LONG_MIN};
+
+	for (byte i=0; i<sizeof(nums)/sizeof(nums[0]); i++)
+		for (byte dec=1; dec<=5; dec++)
+			check(nums[i], dec, 0, '.', 0, ' ');
+}
+
+void test_layout()
+{
+	static const long	nums[] = {0, -5, 12345, -12345, AVR_LONG_MIN};
+	static const int	lengths[] = {0, 3, 8, 14};
+	static const char	fillers[] = {' ', '0', '*'};
+	static const char	dividers[] = {'.', ','};
+	static const int	xs[] = {0, 37, CENTER, RIGHT};
+
+	for (byte i=0; i<sizeof(nums)/sizeof(nums[0]); i++)
+		for (byte dec=1; dec<=5; dec+=2)
+			for (byte l=0; l<sizeof(lengths)/sizeof(lengths[0]); l++)
+				for (byte f=0; f<sizeof(fillers); f++)
+					for (byte d=0; d<sizeof(dividers); d++)
+						for (byte x=0; x<sizeof(xs)/sizeof(xs[0]); x++)
+							check(nums[i], dec, xs[x], dividers[d], lengths[l], fillers[f]);
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_values);
+	RUN_TEST(test_layout);
+	return UNITY_END();
+}
@@ -0,0 +1,154 @@
+// Checks that UTFT_Panel, which clears, fills and aligns text with its
+// compile-time size, sends exactly what UTFT does with the runtime size.
+// Two modules of the same model share the data bus, each with its own
+// control pins: one driven by a UTFT, one by a UTFT_Panel.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_Host.h>
+
+extern uint8_t BigFont[];
+
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS		40
+#define LCD_RST		41
+#define PANEL_RS	42
+#define PANEL_WR	43
+#define PANEL_CS	44
+#define PANEL_RST	45
+
+static HostPanel	*lcd_panel, *panel_panel;
+static UTFT			*lcd;
+static UTFT			*panel;		// The UTFT_Panel, through its base class only for delete
+
+static void open(UTFT *p)
+{
+	lcd_panel = new HostPanel(320, 480, HOST_BUS_16, LCD_CS, LCD_RS, LCD_WR);
+	panel_panel = new HostPanel(320, 480, HOST_BUS_16, PANEL_CS, PANEL_RS, PANEL_WR);
+	panel = p;
+}
+
+static void check_same(const char *what)
+{
+	TEST_ASSERT_TRUE_MESSAGE(lcd_panel->stream.size()>0, what);
+	TEST_ASSERT_EQUAL_MESSAGE(lcd_panel->stream.size(), panel_panel->stream.size(), what);
+	TEST_ASSERT_TRUE_MESSAGE(lcd_panel->stream==panel_panel->stream, what);
+	TEST_ASSERT_EQUAL_MESSAGE(lcd_panel->edges, panel_panel->edges, what);
+	lcd_panel->clearCounts();
+	panel_panel->clearCounts();
+}
+
+template <byte model, byte orientation>
+static void check_model()
+{
+	UTFT_Panel<model, orientation>	*p;
+	String							st("BLUE TEAM:");
+
+	host_reset();
+	p = new UTFT_Panel<model, orientation>(PANEL_RS, PANEL_WR, PANEL_CS, PANEL_RST);
+	open(p);
+	lcd = new UTFT(model, LCD_RS, LCD_WR, LCD_CS, LCD_RST);
+
+	lcd->InitLCD(orientation);
+	p->InitLCD();
+	check_same("InitLCD");
+	TEST_ASSERT_EQUAL(lcd->getDisplayXSize(), p->width);
+	TEST_ASSERT_EQUAL(lcd->getDisplayYSize(), p->height);
+	TEST_ASSERT_EQUAL(lcd->getDisplayXSize(), p->getDisplayXSize());
+	TEST_ASSERT_EQUAL(lcd->getDisplayYSize(), p->getDisplayYSize());
+
+	lcd->clrScr();
+	p->clrScr();
+	check_same("clrScr");
+	lcd->fillScr(VGA_WHITE);
+	p->fillScr(VGA_WHITE);
+	check_same("fillScr(word)");
+	lcd->fillScr(255, 0, 128);
+	p->fillScr(255, 0, 128);
+	check_same("fillScr(r, g, b)");
+
+	lcd->setFont(BigFont);
+	p->setFont(BigFont);
+	lcd->print("RED TEAM:", CENTER, 25);
+	p->print("RED TEAM:", CENTER, 25);
+	check_same("print(CENTER)");
+	lcd->print(st, RIGHT, 50);
+	p->print(st, RIGHT, 50);
+	check_same("print(String, RIGHT)");
+	lcd->print(F("GAME TIMER: "), CENTER, 305);
+	p->print(F("GAME TIMER: "), CENTER, 305);
+	check_same("print(F(), CENTER)");
+	lcd->print(F("ms"), 7, 100, 90);
+	p->print(F("ms"), 7, 100, 90);
+	check_same("print(F(), 90 degrees)");
+
+	// Through the base class
+	static_cast<UTFT *>(p)->print("RED TEAM:", CENTER, 25);
+	lcd->print("RED TEAM:", CENTER, 25);
+	check_same("UTFT::print(CENTER)");
+
+	for (int y=0; y<panel_panel->pages(); y++)
+		for (int x=0; x<panel_panel->columns(); x++)
+			if (lcd_panel->pixel(x, y)!=panel_panel->pixel(x, y))
+				TEST_ASSERT_EQUAL_MESSAGE(lcd_panel->pixel(x, y), panel_panel->pixel(x, y), "frames differ");
+}
+
+void setUp()
+{
+	lcd_panel = panel_panel = NULL;
+	lcd = panel = NULL;
+}
+
+void tearDown()
+{
+	delete lcd;
+	delete panel;
+	delete lcd_panel;
+	delete panel_panel;
+}
+
+void test_madctl_landscape()
+{
+	check_model<ILI9486, LANDSCAPE>();
+}
+
+void test_madctl_portrait()
+{
+	check_model<ILI9486, PORTRAIT>();
+}
+
+void test_landscape()
+{
+	check_model<ILI9488, LANDSCAPE>();
+}
+
+void test_portrait()
+{
+	check_model<ILI9488, PORTRAIT>();
+}
+
+// Not initialised: nothing is sent
+void test_not_ready()
+{
+	UTFT_Panel<ILI9486>	*p;
+
+	host_reset();
+	p = new UTFT_Panel<ILI9486>(PANEL_RS, PANEL_WR, PANEL_CS, PANEL_RST);
+	open(p);
+	p->clrScr();
+	p->fillScr(VGA_RED);
+	p->print("X", CENTER, 0);
+	TEST_ASSERT_EQUAL(0, panel_panel->edges);
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_madctl_landscape);
+	RUN_TEST(test_madctl_portrait);
+	RUN_TEST(test_landscape);
+	RUN_TEST(test_portrait);
+	RUN_TEST(test_not_ready);
+	return UNITY_END();
+}
@@ -0,0 +1,160 @@
+// Checks the bus transaction profiler against the WR pulses the simulated
+// ILI9486 sees: every pulse has to be counted exactly once, as a command,
+// a data write or a repeated pixel, against the function that sent it.
+// Pulses sent while CS is high, like those of clrXY(), are counted too.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_GlyphCache.h>
+#include <UTFT_NumField.h>
+#include <UTFT_Host.h>
+
+extern uint8_t BigFont[];
+extern uint8_t SevenSeg_XXXL_Num[];
+
+// Wired like src/main.cpp
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS		40
+#define LCD_RST		41
+
+static HostPanel	*panel;
+static UTFT			*lcd;
+
+static unsigned long counted(utft_profile_type p)
+{
+	return p.com+p.data+p.wr;
+}
+
+// Only id may have been charged with anything
+static void check_only(byte id)
+{
+	for (byte i=0; i<PROFILE_SLOTS; i++)
+		if (i!=id)
+			TEST_ASSERT_EQUAL_MESSAGE(0, counted(lcd->getProfile(i)), lcd->getProfileName(i));
+	TEST_ASSERT_EQUAL(panel->edges, counted(lcd->getProfile(id)));
+}
+
+void setUp()
+{
+	host_reset();
+	panel = new HostPanel(320, 480, HOST_BUS_16, LCD_CS, LCD_RS, LCD_WR);
+	lcd = new UTFT(ILI9486, LCD_RS, LCD_WR, LCD_CS, LCD_RST);
+	lcd->InitLCD(LANDSCAPE);
+}
+
+void tearDown()
+{
+	delete lcd;
+	delete panel;
+}
+
+void test_initlcd()
+{
+	TEST_ASSERT_TRUE(lcd->ready());
+	TEST_ASSERT_EQUAL(1, lcd->getProfile(PROFILE_INITLCD).calls);
+	check_only(PROFILE_INITLCD);
+}
+
+void test_primitives()
+{
+	static const byte	ids[] = {PROFILE_CLRSCR, PROFILE_FILLSCR, PROFILE_DRAWPIXEL, PROFILE_DRAWLINE,
+								 PROFILE_DRAWRECT, PROFILE_FILLRECT, PROFILE_DRAWCIRCLE, PROFILE_FILLCIRCLE,
+								 PROFILE_PRINT, PROFILE_PRINTNUM};
+
+	lcd->setFont(BigFont);
+	for (byte i=0; i<sizeof(ids); i++)
+	{
+		lcd->resetProfile();
+		panel->clearCounts();
+		lcd->setColor(VGA_RED);
+		switch (ids[i])
+		{
+		case PROFILE_CLRSCR:		lcd->clrScr();							break;
+		case PROFILE_FILLSCR:		lcd->fillScr(VGA_BLUE);					break;
+		case PROFILE_DRAWPIXEL:		lcd->drawPixel(5, 7);					break;
+		case PROFILE_DRAWLINE:		lcd->drawLine(3, 4, 200, 99);			break;
+		case PROFILE_DRAWRECT:		lcd->drawRoundRect(10, 10, 60, 40);		break;
+		case PROFILE_FILLRECT:		lcd->fillRoundRect(10, 10, 60, 40);		break;
+		case PROFILE_DRAWCIRCLE:	lcd->drawCircle(100, 100, 30);			break;
+		case PROFILE_FILLCIRCLE:	lcd->fillCircle(100, 100, 30);			break;
+		case PROFILE_PRINT:			lcd->print(F("Score"), 20, 200);		break;
+		case PROFILE_PRINTNUM:		lcd->printNumI(-1234L, 20, 250, 7);		break;
+		}
+		TEST_ASSERT_EQUAL_MESSAGE(1, lcd->getProfile(ids[i]).calls, lcd->getProfileName(ids[i]));
+		TEST_ASSERT_TRUE(panel->edges>0);
+		check_only(ids[i]);
+	}
+}
+
+// A fillRect() is one window and one pixel per WR pulse. Without
+// UTFT_BUS, _fast_fill_16() sends one pixel more when the length is not
+// a multiple of 16, which wraps around to the start of the window.
+void test_fillrect_pixels()
+{
+	utft_profile_type	p;
+
+	lcd->resetProfile();
+	panel->clearCounts();
+	lcd->setColor(VGA_GREEN);
+	lcd->fillRect(10, 20, 29, 29);
+	p = lcd->getProfile(PROFILE_FILLRECT);
+	TEST_ASSERT_EQUAL(1, p.setxy);
+	TEST_ASSERT_TRUE((panel->pixels==200) or (panel->pixels==201));
+	TEST_ASSERT_EQUAL(VGA_GREEN, panel->pixel(10, 20));
+	TEST_ASSERT_EQUAL(VGA_GREEN, panel->pixel(29, 29));
+	TEST_ASSERT_EQUAL(0, panel->pixel(30, 29));
+	check_only(PROFILE_FILLRECT);
+}
+
+// The displayUpdate() pass of src/main.cpp
+void test_frame()
+{
+	UTFT_GlyphCache		glyphs(lcd);
+	UTFT_NumField		red(lcd, 60, 80, SevenSeg_XXXL_Num, 2);
+	UTFT_NumField		blue(lcd, 310, 80, SevenSeg_XXXL_Num, 2);
+	HostPrint			out;
+	utft_profile_type	total;
+
+	lcd->setFont(BigFont);
+	lcd->clrScr();
+	lcd->fillScr(VGA_WHITE);
+	for (int pass=0; pass<3; pass++)
+	{
+		lcd->resetProfile();
+		panel->clearCounts();
+		lcd->setColor(VGA_RED);
+		lcd->fillRect(230, 0, 245, 305);
+		lcd->setColor(VGA_BLUE);
+		lcd->fillRect(245, 0, 260, 305);
+		lcd->setColor(VGA_WHITE);
+		glyphs.print("RED TEAM:", 50, 25);
+		glyphs.print("BLUE TEAM:", 280, 25);
+		red.set(pass);
+		blue.set(pass*7);
+		lcd->print(F("GAME TIMER: "), 120, 305);
+		lcd->printNumI(pass*1000UL, 312, 305, 7);
+		lcd->print(F("ms"), 424, 305);
+
+		total = lcd->getProfileTotal();
+		TEST_ASSERT_EQUAL(panel->edges, counted(total));
+		TEST_ASSERT_EQUAL(2, lcd->getProfile(PROFILE_FILLRECT).calls);
+		TEST_ASSERT_EQUAL(2, lcd->getProfile(PROFILE_GLYPHCACHE).calls);
+		TEST_ASSERT_EQUAL(2, lcd->getProfile(PROFILE_NUMFIELD).calls);
+		TEST_ASSERT_EQUAL(0, counted(lcd->getProfile(PROFILE_OTHER)));
+	}
+
+	lcd->printProfile(out);
+	TEST_ASSERT_TRUE(out.text.find("fillRect\t2\t")!=std::string::npos);
+	TEST_ASSERT_TRUE(out.text.find("total\t")!=std::string::npos);
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_initlcd);
+	RUN_TEST(test_primitives);
+	RUN_TEST(test_fillrect_pixels);
+	RUN_TEST(test_frame);
+	return UNITY_END();
+}
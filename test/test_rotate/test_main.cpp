@@ -0,0 +1,202 @@
+// Checks the rotated drawBitmap() against a floating point reference:
+// destination pixel (tx,ty) shows the source pixel under its centre,
+// rotated back by deg around (x+rox, y+roy). Corners of the bounding box
+// outside the source are bgcolor, or left alone when it is transparent,
+// and nothing around the bounding box is touched.
+//
+// Samples that fall within a hair of a source pixel edge are skipped, as
+// 16.16 fixed point may round them either way, and so is the one pixel
+// band along the bounding box, whose edges are rounded outwards.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_Host.h>
+#include <math.h>
+
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS		40
+#define LCD_RST		41
+
+#define BACKGROUND	0x1234
+#define CORNERS		0xF81F
+
+#define SRC_W		12
+#define SRC_H		8
+
+#define EDGE		0.002
+
+static HostPanel	*panel;
+static UTFT			*lcd;
+static boolean		rotated;	// LANDSCAPE without memory access control
+
+static unsigned int	bitmap[SRC_W*SRC_H];
+
+static void open(byte model, byte orientation)
+{
+	host_reset();
+	panel = new HostPanel(320, 480, HOST_BUS_16, LCD_CS, LCD_RS, LCD_WR);
+	lcd = new UTFT(model, LCD_RS, LCD_WR, LCD_CS, LCD_RST);
+	lcd->InitLCD(orientation);
+	rotated = (lcd->orient==LANDSCAPE);
+}
+
+// Reads back logical (x,y)
+static word at(int x, int y)
+{
+	if (rotated)
+		return panel->pixel(y, 479-x);
+	return panel->pixel(x, y);
+}
+
+static boolean near_edge(double v)
+{
+	return fabs(v-floor(v+0.5))<EDGE;
+}
+
+static void check(int x, int y, int deg, int rox, int roy, uint32_t bgcolor)
+{
+	double	radian = deg*0.0175;		// As drawBitmap() has it
+	double	c = cos(radian), s = sin(radian);
+	double	bx1, by1, bx2, by2, px, py, dx, dy, u, v;
+	int		cx[4] = {0, SRC_W, 0, SRC_W};
+	int		cy[4] = {0, 0, SRC_H, SRC_H};
+	int		inside = 0, skipped = 0;
+	word	want;
+	char	msg[80];
+
+	bx1 = by1 = 1e9;
+	bx2 = by2 = -1e9;
+	for (int i=0; i<4; i++)
+	{
+		px = x+rox+((cx[i]-rox)*c)-((cy[i]-roy)*s);
+		py = y+roy+((cy[i]-roy)*c)+((cx[i]-rox)*s);
+		bx1 = fmin(bx1, px);
+		bx2 = fmax(bx2, px);
+		by1 = fmin(by1, py);
+		by2 = fmax(by2, py);
+	}
+
+	lcd->fillScr(BACKGROUND);
+	lcd->drawBitmap(x, y, SRC_W, SRC_H, bitmap, deg, rox, roy, bgcolor);
+	for (int ty=int(by1)-3; ty<=int(by2)+3; ty++)
+		for (int tx=int(bx1)-3; tx<=int(bx2)+3; tx++)
+		{
+			snprintf(msg, sizeof(msg), "%d degrees around %d,%d at %d,%d", deg, rox, roy, tx, ty);
+			if ((tx+1<=floor(bx1)) or (tx>=ceil(bx2)) or (ty+1<=floor(by1)) or (ty>=ceil(by2)))
+			{
+				TEST_ASSERT_EQUAL_MESSAGE(BACKGROUND, at(tx, ty), msg);
+				continue;
+			}
+			dx = tx+0.5-(x+rox);
+			dy = ty+0.5-(y+roy);
+			u = (dx*c)+(dy*s)+rox;
+			v = (dy*c)-(dx*s)+roy;
+			if (near_edge(u) or near_edge(v))
+			{
+				skipped++;
+				continue;
+			}
+			if ((u>=0) and (v>=0) and (u<SRC_W) and (v<SRC_H))
+			{
+				want = bitmap[int(v)*SRC_W+int(u)];
+				inside++;
+			}
+			else if ((tx<floor(bx1)+1) or (tx>=ceil(bx2)-1) or (ty<floor(by1)+1) or (ty>=ceil(by2)-1))
+				continue;
+			else if (bgcolor==VGA_TRANSPARENT)
+				want = BACKGROUND;
+			else
+				want = bgcolor;
+			TEST_ASSERT_EQUAL_MESSAGE(want, at(tx, ty), msg);
+		}
+
+	// No holes: every source pixel shows up about once
+	snprintf(msg, sizeof(msg), "%d degrees: %d inside, %d skipped", deg, inside, skipped);
+	TEST_ASSERT_TRUE_MESSAGE(inside+skipped>=SRC_W*SRC_H*9/10, msg);
+	TEST_ASSERT_TRUE_MESSAGE(skipped<=SRC_W*SRC_H/4, msg);
+}
+
+static void check_all()
+{
+	static const int	degs[] = {90, 180, 270, -90, 30, 45, 135, -60, 359};
+
+	for (byte i=0; i<sizeof(degs)/sizeof(degs[0]); i++)
+	{
+		check(100, 120, degs[i], SRC_W/2, SRC_H/2, VGA_TRANSPARENT);
+		check(100, 120, degs[i], SRC_W/2, SRC_H/2, CORNERS);
+		check(60, 70, degs[i], 0, 0, CORNERS);
+		check(60, 70, degs[i], 3, 7, VGA_TRANSPARENT);
+	}
+}
+
+void setUp()
+{
+	for (int i=0; i<SRC_W*SRC_H; i++)
+		bitmap[i] = 0x0101*i + 0x0800;
+	panel = NULL;
+	lcd = NULL;
+}
+
+void tearDown()
+{
+	delete lcd;
+	delete panel;
+}
+
+void test_portrait()
+{
+	open(ILI9486, PORTRAIT);
+	check_all();
+}
+
+void test_madctl_landscape()
+{
+	open(ILI9486, LANDSCAPE);
+	TEST_ASSERT_FALSE(rotated);
+	check_all();
+}
+
+// Rows are sent right to left into a panel column
+void test_landscape()
+{
+	open(ILI9488, LANDSCAPE);
+	TEST_ASSERT_TRUE(rotated);
+	check_all();
+}
+
+// 0 degrees is a plain drawBitmap(), bgcolor has no corners to fill
+void test_zero()
+{
+	open(ILI9486, PORTRAIT);
+	lcd->fillScr(BACKGROUND);
+	lcd->drawBitmap(10, 20, SRC_W, SRC_H, bitmap, 0, 5, 5, CORNERS);
+	for (int y=-1; y<=SRC_H; y++)
+		for (int x=-1; x<=SRC_W; x++)
+			if ((x<0) or (y<0) or (x>=SRC_W) or (y>=SRC_H))
+				TEST_ASSERT_EQUAL(BACKGROUND, at(10+x, 20+y));
+			else
+				TEST_ASSERT_EQUAL(bitmap[y*SRC_W+x], at(10+x, 20+y));
+}
+
+// 180 degrees around the centre is the bitmap read backwards
+void test_half_turn()
+{
+	open(ILI9486, PORTRAIT);
+	lcd->fillScr(BACKGROUND);
+	lcd->drawBitmap(10, 20, SRC_W, SRC_H, bitmap, 180, SRC_W/2, SRC_H/2, CORNERS);
+	for (int y=0; y<SRC_H; y++)
+		for (int x=0; x<SRC_W; x++)
+			TEST_ASSERT_EQUAL(bitmap[(SRC_H-1-y)*SRC_W+(SRC_W-1-x)], at(10+x, 20+y));
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_portrait);
+	RUN_TEST(test_madctl_landscape);
+	RUN_TEST(test_landscape);
+	RUN_TEST(test_zero);
+	RUN_TEST(test_half_turn);
+	return UNITY_END();
+}
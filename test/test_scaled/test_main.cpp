@@ -0,0 +1,174 @@
+// Checks drawBitmapScaled() pixel for pixel against a plain nearest-
+// neighbour scaler: destination pixel (tx,ty) of a dw x dh image is
+// source pixel (((2tx+1)*sx)/(2dw), ((2ty+1)*sy)/(2dh)). Pixels around
+// the image must be left alone.
+//
+// The ILI9486 is rotated with memory access control, so its rows are
+// always sent left to right. The ILI9488 is not, and in LANDSCAPE each
+// row is sent right to left into a panel column.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_Host.h>
+
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS		40
+#define LCD_RST		41
+
+#define BACKGROUND	0x1234
+
+#define SRC_W		7
+#define SRC_H		5
+
+static HostPanel	*panel;
+static UTFT			*lcd;
+static boolean		rotated;	// LANDSCAPE without memory access control
+
+// Every pixel different
+static unsigned int	distinct[SRC_W*SRC_H];
+// Runs of equal pixels, so neighbours are sent as one fill
+static unsigned int	runs[SRC_W*SRC_H];
+
+static const word	scales[] = {BITMAP_SCALE(1), BITMAP_SCALE(2), BITMAP_SCALE(1.5), BITMAP_SCALE(0.5),
+								100, 700, BITMAP_SCALE(3.25), 37};
+
+static void open(byte model, byte orientation)
+{
+	host_reset();
+	panel = new HostPanel(320, 480, HOST_BUS_16, LCD_CS, LCD_RS, LCD_WR);
+	lcd = new UTFT(model, LCD_RS, LCD_WR, LCD_CS, LCD_RST);
+	lcd->InitLCD(orientation);
+	rotated = (lcd->orient==LANDSCAPE);
+	lcd->fillScr(BACKGROUND);
+}
+
+// Reads back logical (x,y)
+static word at(int x, int y)
+{
+	if (rotated)
+		return panel->pixel(y, 479-x);
+	return panel->pixel(x, y);
+}
+
+static void check(int x, int y, bitmapdatatype src, word scalex, word scaley)
+{
+	int		dw = (long(SRC_W)*scalex)>>8;
+	int		dh = (long(SRC_H)*scaley)>>8;
+	int		sx, sy;
+	word	want;
+	char	msg[80];
+
+	lcd->fillScr(BACKGROUND);
+	lcd->drawBitmapScaled(x, y, SRC_W, SRC_H, src, scalex, scaley);
+	for (int ty=-1; ty<=dh; ty++)
+		for (int tx=-1; tx<=dw; tx++)
+		{
+			if ((tx<0) or (ty<0) or (tx>=dw) or (ty>=dh))
+				want = BACKGROUND;
+			else
+			{
+				sx = (long(2*tx+1)*SRC_W)/(2*dw);
+				sy = (long(2*ty+1)*SRC_H)/(2*dh);
+				want = src[sy*SRC_W+sx];
+			}
+			snprintf(msg, sizeof(msg), "scale %u/%u at %d,%d", scalex, scaley, tx, ty);
+			TEST_ASSERT_EQUAL_MESSAGE(want, at(x+tx, y+ty), msg);
+		}
+}
+
+static void check_all()
+{
+	for (byte i=0; i<sizeof(scales)/sizeof(scales[0]); i++)
+		for (byte j=0; j<sizeof(scales)/sizeof(scales[0]); j++)
+		{
+			check(13, 9, distinct, scales[i], scales[j]);
+			check(1, 2, runs, scales[i], scales[j]);
+		}
+}
+
+void setUp()
+{
+	for (int y=0; y<SRC_H; y++)
+		for (int x=0; x<SRC_W; x++)
+		{
+			distinct[y*SRC_W+x] = 0x0100*(y+1) + x;
+			runs[y*SRC_W+x] = 0x0100*(y/2+1) + x/3;
+		}
+	panel = NULL;
+	lcd = NULL;
+}
+
+void tearDown()
+{
+	delete lcd;
+	delete panel;
+}
+
+void test_madctl_landscape()
+{
+	open(ILI9486, LANDSCAPE);
+	TEST_ASSERT_FALSE(rotated);
+	check_all();
+}
+
+void test_madctl_portrait()
+{
+	open(ILI9486, PORTRAIT);
+	check_all();
+}
+
+void test_landscape()
+{
+	open(ILI9488, LANDSCAPE);
+	TEST_ASSERT_TRUE(rotated);
+	check_all();
+}
+
+void test_portrait()
+{
+	open(ILI9488, PORTRAIT);
+	check_all();
+}
+
+// Too small to show anything
+void test_empty()
+{
+	open(ILI9486, LANDSCAPE);
+	panel->clearCounts();
+	lcd->drawBitmapScaled(0, 0, SRC_W, SRC_H, distinct, 36, BITMAP_SCALE(1));
+	lcd->drawBitmapScaled(0, 0, SRC_W, SRC_H, distinct, BITMAP_SCALE(1), 51);
+	TEST_ASSERT_EQUAL(0, panel->pixels);
+}
+
+// Integer scales that don't fit 8.8 fixed point are clamped, and those
+// below 1 draw nothing
+void test_integer()
+{
+	static unsigned int	dot[1] = {0xBEEF};
+
+	open(ILI9486, LANDSCAPE);
+	panel->clearCounts();
+	lcd->drawBitmap(0, 0, SRC_W, SRC_H, distinct, 0);
+	lcd->drawBitmap(0, 0, SRC_W, SRC_H, distinct, -2);
+	TEST_ASSERT_EQUAL(0, panel->pixels);
+
+	lcd->drawBitmap(10, 20, 1, 1, dot, 300);
+	TEST_ASSERT_EQUAL(255L*255, panel->pixels);
+	TEST_ASSERT_EQUAL(0xBEEF, at(10, 20));
+	TEST_ASSERT_EQUAL(0xBEEF, at(264, 274));
+	TEST_ASSERT_EQUAL(BACKGROUND, at(265, 274));
+	TEST_ASSERT_EQUAL(BACKGROUND, at(264, 275));
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_madctl_landscape);
+	RUN_TEST(test_madctl_portrait);
+	RUN_TEST(test_landscape);
+	RUN_TEST(test_portrait);
+	RUN_TEST(test_empty);
+	RUN_TEST(test_integer);
+	return UNITY_END();
+}
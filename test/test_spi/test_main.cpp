@@ -0,0 +1,200 @@
+// Checks the SPI module paths of the serial buses against bit-banging.
+// Two panels are wired to the same kind of module: one on MOSI and SCK,
+// which UTFT drives through SPDR, and one on ordinary pins, which it
+// bit-bangs. Both must see the same bits, D/C included, and end up with
+// the same frame.
+//
+// Serial models are disabled in memorysaver.h, so the modules here use a
+// small descriptor of their own: a 240x320 MIPI DCS controller that only
+// needs Sleep Out and Display On. This only runs with the bus chosen at
+// runtime, see env:native_runtime.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_Host.h>
+#include <hardware/avr/HW_ATmega1280_bus.h>
+
+extern uint8_t BigFont[];
+
+// Through the SPI module
+#define SPI_CS		10
+#define SPI_RST		11
+#define SPI_RS		12
+// Bit-banged
+#define BB_SDA		22
+#define BB_SCL		23
+#define BB_CS		24
+#define BB_RST		25
+#define BB_RS		26
+
+static const uint8_t	test_init_table[] PROGMEM = {
+	10, 5,						// Reset low 10us, then 5ms
+
+	0x11, INIT_DELAY | 0, 5,	// Sleep OUT
+	0x3A, 1,					// Pixel Format Set
+		0x55,
+	0x29, 0,					// Display ON
+	INIT_END
+};
+
+static const utft_driver_type	test_driver_s4p PROGMEM = {239, 319, SERIAL_4PIN, test_init_table, NULL, &UTFT::_set_window_dcs, NULL};
+static const utft_driver_type	test_driver_s5p PROGMEM = {239, 319, SERIAL_5PIN, test_init_table, NULL, &UTFT::_set_window_dcs, NULL};
+
+static unsigned int		bitmap[6*4];
+
+static HostPanel	*spi_panel, *bb_panel;
+static UTFT			*spi_lcd, *bb_lcd;
+
+static void open(byte serial_mode)
+{
+	const utft_driver_type	*driver = (serial_mode==SERIAL_4PIN) ? &test_driver_s4p : &test_driver_s5p;
+	byte					bus = (serial_mode==SERIAL_4PIN) ? HOST_BUS_SERIAL4 : HOST_BUS_SERIAL5;
+
+	spi_panel = new HostPanel(240, 320, bus, SPI_CS, SPI_RS, SCK, MOSI);
+	bb_panel = new HostPanel(240, 320, bus, BB_CS, BB_RS, BB_SCL, BB_SDA);
+	spi_lcd = new UTFT();
+	spi_lcd->_begin(driver, ILI9341_S4P, MOSI, SCK, SPI_CS, SPI_RST, SPI_RS);
+	bb_lcd = new UTFT();
+	bb_lcd->_begin(driver, ILI9341_S4P, BB_SDA, BB_SCL, BB_CS, BB_RST, BB_RS);
+	spi_lcd->InitLCD(PORTRAIT);
+	bb_lcd->InitLCD(PORTRAIT);
+	TEST_ASSERT_TRUE(spi_lcd->_hw_spi);
+	TEST_ASSERT_FALSE(bb_lcd->_hw_spi);
+}
+
+static void check_bits(const char *what)
+{
+	TEST_ASSERT_TRUE_MESSAGE(spi_panel->bits.size()>0, what);
+	TEST_ASSERT_EQUAL_MESSAGE(bb_panel->bits.size(), spi_panel->bits.size(), what);
+	TEST_ASSERT_TRUE_MESSAGE(spi_panel->bits==bb_panel->bits, what);
+}
+
+static void check_frames()
+{
+	for (int y=0; y<320; y++)
+		for (int x=0; x<240; x++)
+			if (spi_panel->pixel(x, y)!=bb_panel->pixel(x, y))
+				TEST_ASSERT_EQUAL_MESSAGE(bb_panel->pixel(x, y), spi_panel->pixel(x, y), "frames differ");
+}
+
+static void draw(UTFT *lcd, byte step)
+{
+	switch (step)
+	{
+	case 0:	lcd->clrScr();									break;
+	case 1:	lcd->fillScr(VGA_NAVY);							break;
+	case 2:	lcd->fillRect(3, 4, 9, 6);						break;	// 21 pixels
+	case 3:	lcd->fillRect(20, 20, 99, 29);					break;	// 800 pixels
+	case 4:	lcd->drawPixel(7, 300);							break;
+	case 5:	lcd->drawLine(0, 0, 239, 150);					break;
+	case 6:	lcd->drawHLine(5, 200, 130);					break;
+	case 7:	lcd->fillCircle(120, 250, 17);					break;
+	case 8:	lcd->print(F("Serial 42"), 10, 100);			break;
+	case 9:	lcd->drawBitmap(200, 10, 6, 4, bitmap, 2);		break;
+	}
+}
+
+#define DRAW_STEPS	10
+
+static void check_drawing()
+{
+	char	msg[32];
+
+	check_bits("InitLCD");
+	for (byte step=0; step<DRAW_STEPS; step++)
+	{
+		spi_panel->clearCounts();
+		bb_panel->clearCounts();
+		draw(spi_lcd, step);
+		draw(bb_lcd, step);
+		snprintf(msg, sizeof(msg), "step %d", step);
+		check_bits(msg);
+	}
+	TEST_ASSERT_EQUAL(VGA_NAVY, spi_panel->pixel(0, 319));
+	TEST_ASSERT_EQUAL(VGA_WHITE, spi_panel->pixel(25, 25));
+	check_frames();
+}
+
+// Sends n pixels with _bus_fill<Spi> through spi_lcd and one by one with
+// Ref::data() through bb_lcd
+template <class Spi, class Ref>
+static void check_fill(long n)
+{
+	char	msg[32];
+
+	snprintf(msg, sizeof(msg), "%ld pixels", n);
+	spi_panel->clearCounts();
+	bb_panel->clearCounts();
+	cbi(spi_lcd->P_CS, spi_lcd->B_CS);
+	_bus_fill<Spi>(spi_lcd, 0xA5, 0x3C, n);
+	sbi(spi_lcd->P_CS, spi_lcd->B_CS);
+	cbi(bb_lcd->P_CS, bb_lcd->B_CS);
+	for (long i=0; i<n; i++)
+		Ref::data(bb_lcd, 0xA5, 0x3C);
+	sbi(bb_lcd->P_CS, bb_lcd->B_CS);
+
+	TEST_ASSERT_EQUAL_MESSAGE(bb_panel->bits.size(), spi_panel->bits.size(), msg);
+	TEST_ASSERT_TRUE_MESSAGE(spi_panel->bits==bb_panel->bits, msg);
+	TEST_ASSERT_EQUAL_MESSAGE(2*n, spi_panel->data, msg);
+	TEST_ASSERT_EQUAL_MESSAGE(0, spi_panel->com, msg);
+}
+
+void setUp()
+{
+	host_reset();
+	for (int i=0; i<6*4; i++)
+		bitmap[i] = 0x1111*i + 0x0F0F;
+	spi_panel = bb_panel = NULL;
+	spi_lcd = bb_lcd = NULL;
+}
+
+void tearDown()
+{
+	delete spi_lcd;
+	delete bb_lcd;
+	delete spi_panel;
+	delete bb_panel;
+}
+
+void test_draw_4pin()
+{
+	open(SERIAL_4PIN);
+	spi_lcd->setFont(BigFont);
+	bb_lcd->setFont(BigFont);
+	check_drawing();
+}
+
+void test_draw_5pin()
+{
+	open(SERIAL_5PIN);
+	spi_lcd->setFont(BigFont);
+	bb_lcd->setFont(BigFont);
+	check_drawing();
+}
+
+// Four pixels go out as nine bytes, what is left one frame at a time
+void test_fill_4pin()
+{
+	open(SERIAL_4PIN);
+	for (long n=0; n<14; n++)
+		check_fill<UTFT_BusSPI4, UTFT_BusSerial4>(n);
+	check_fill<UTFT_BusSPI4, UTFT_BusSerial4>(1001);
+}
+
+void test_fill_5pin()
+{
+	open(SERIAL_5PIN);
+	for (long n=0; n<14; n++)
+		check_fill<UTFT_BusSPI5, UTFT_BusSerial5>(n);
+	check_fill<UTFT_BusSPI5, UTFT_BusSerial5>(1001);
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_draw_4pin);
+	RUN_TEST(test_draw_5pin);
+	RUN_TEST(test_fill_4pin);
+	RUN_TEST(test_fill_5pin);
+	return UNITY_END();
+}
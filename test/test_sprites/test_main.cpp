@@ -0,0 +1,203 @@
+// Checks UTFT_Sprites against a frame painted in memory: the background,
+// then every visible sprite in the order it was added, leaving out the
+// pixels in its key color. The whole screen must match after every
+// update(), while a key colored sprite is moved across a plain one.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_Sprites.h>
+#include <UTFT_Host.h>
+
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS		40
+#define LCD_RST		41
+
+#define BACKGROUND	0x0841
+#define KEY			0xF81F
+
+#define BOX_W		10
+#define BOX_H		8
+#define RING_W		12
+#define RING_H		10
+
+static HostPanel	*panel;
+static UTFT			*lcd;
+static UTFT_Sprites	*sprites;
+static boolean		rotated;	// LANDSCAPE without memory access control
+
+static unsigned int	box[BOX_W*BOX_H];
+static unsigned int	ring[RING_W*RING_H];	// Key colored inside and in the corners
+
+static word			frame[480*320];
+static int			width, height;
+
+static struct
+{
+	int				id, x, y, sx, sy;
+	bitmapdatatype	data;
+	uint32_t		key;
+	boolean			visible;
+} placed[2];
+
+static void open(byte model, byte orientation)
+{
+	host_reset();
+	panel = new HostPanel(320, 480, HOST_BUS_16, LCD_CS, LCD_RS, LCD_WR);
+	lcd = new UTFT(model, LCD_RS, LCD_WR, LCD_CS, LCD_RST);
+	lcd->InitLCD(orientation);
+	rotated = (lcd->orient==LANDSCAPE);
+	width = lcd->getDisplayXSize();
+	height = lcd->getDisplayYSize();
+	lcd->fillScr(BACKGROUND);
+	sprites = new UTFT_Sprites(lcd);
+	sprites->setBackground(BACKGROUND);
+
+	placed[0].id = sprites->addSprite(box, BOX_W, BOX_H);
+	placed[0].data = box;
+	placed[0].sx = BOX_W;
+	placed[0].sy = BOX_H;
+	placed[0].key = VGA_TRANSPARENT;
+	placed[1].id = sprites->addSprite(ring, RING_W, RING_H, KEY);
+	placed[1].data = ring;
+	placed[1].sx = RING_W;
+	placed[1].sy = RING_H;
+	placed[1].key = KEY;
+	for (byte i=0; i<2; i++)
+		placed[i].visible = false;
+}
+
+// Reads back logical (x,y)
+static word at(int x, int y)
+{
+	if (rotated)
+		return panel->pixel(y, 479-x);
+	return panel->pixel(x, y);
+}
+
+static void move(byte i, int x, int y)
+{
+	placed[i].x = x;
+	placed[i].y = y;
+	sprites->moveTo(placed[i].id, x, y);
+}
+
+static void show(byte i, boolean visible)
+{
+	placed[i].visible = visible;
+	if (visible)
+		sprites->show(placed[i].id);
+	else
+		sprites->hide(placed[i].id);
+}
+
+static void check_update(const char *what)
+{
+	int		x, y;
+	word	col;
+
+	sprites->update();
+
+	for (long i=0; i<long(width)*height; i++)
+		frame[i] = BACKGROUND;
+	for (byte i=0; i<2; i++)
+		if (placed[i].visible)
+			for (int ty=0; ty<placed[i].sy; ty++)
+				for (int tx=0; tx<placed[i].sx; tx++)
+				{
+					x = placed[i].x+tx;
+					y = placed[i].y+ty;
+					col = placed[i].data[ty*placed[i].sx+tx];
+					if ((x>=0) and (y>=0) and (x<width) and (y<height) and (col!=placed[i].key))
+						frame[long(y)*width+x] = col;
+				}
+
+	for (y=0; y<height; y++)
+		for (x=0; x<width; x++)
+			if (frame[long(y)*width+x]!=at(x, y))
+				TEST_ASSERT_EQUAL_MESSAGE(frame[long(y)*width+x], at(x, y), what);
+}
+
+static void check_moves()
+{
+	move(0, 40, 40);
+	move(1, 20, 20);
+	show(0, true);
+	show(1, true);
+	check_update("shown");
+
+	// The ring over the box, the box showing through its middle
+	move(1, 36, 37);
+	check_update("ring onto box");
+	move(1, 39, 35);
+	check_update("ring across box");
+
+	// The box moved under the ring
+	move(0, 43, 38);
+	check_update("box under ring");
+
+	// Partly off the screen
+	move(1, width-5, height-3);
+	check_update("ring off screen");
+	move(1, 44, 41);
+	check_update("ring back");
+
+	show(0, false);
+	check_update("box hidden");
+	show(1, false);
+	check_update("ring hidden");
+}
+
+void setUp()
+{
+	for (int i=0; i<BOX_W*BOX_H; i++)
+		box[i] = 0x0100*i + 0x0803;
+	for (int y=0; y<RING_H; y++)
+		for (int x=0; x<RING_W; x++)
+		{
+			if (((x>=3) and (x<RING_W-3) and (y>=3) and (y<RING_H-3)) or ((x+y)<2) or ((x+y)>RING_W+RING_H-4))
+				ring[y*RING_W+x] = KEY;
+			else
+				ring[y*RING_W+x] = 0x2000 + (x<<6) + y;
+		}
+	panel = NULL;
+	lcd = NULL;
+	sprites = NULL;
+}
+
+void tearDown()
+{
+	delete sprites;
+	delete lcd;
+	delete panel;
+}
+
+void test_portrait()
+{
+	open(ILI9486, PORTRAIT);
+	check_moves();
+}
+
+void test_madctl_landscape()
+{
+	open(ILI9486, LANDSCAPE);
+	TEST_ASSERT_FALSE(rotated);
+	check_moves();
+}
+
+// Rows are sent right to left into a panel column
+void test_landscape()
+{
+	open(ILI9488, LANDSCAPE);
+	TEST_ASSERT_TRUE(rotated);
+	check_moves();
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_portrait);
+	RUN_TEST(test_madctl_landscape);
+	RUN_TEST(test_landscape);
+	return UNITY_END();
+}
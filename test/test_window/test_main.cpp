@@ -0,0 +1,154 @@
+// Checks the window cache of _set_window_dcs(): a column or page address
+// command is only left out when the controller is known to hold that
+// range already. Any other command, and a window set while CS is high,
+// must make the next window go out in full. After every step a pixel is
+// written, and it has to land where the window says.
+
+#include <unity.h>
+#include <UTFT.h>
+#include <UTFT_Host.h>
+
+#define LCD_RS		38
+#define LCD_WR		39
+#define LCD_CS		40
+#define LCD_RST		41
+
+#define CASET		0x2A
+#define PASET		0x2B
+#define RAMWR		0x2C
+
+static HostPanel	*panel;
+static UTFT			*lcd;
+
+// The commands sent since the last call, as a string of "2A 2B 2C"
+static std::string commands()
+{
+	std::string	st;
+	char		buf[4];
+
+	for (size_t i=0; i<panel->stream.size(); i++)
+		if ((panel->stream[i]>>16)==0)
+		{
+			snprintf(buf, sizeof(buf), "%s%02lX", st.empty() ? "" : " ", panel->stream[i] & 0xFF);
+			st += buf;
+		}
+	panel->clearCounts();
+	return st;
+}
+
+static void select()
+{
+	cbi(lcd->P_CS, lcd->B_CS);
+}
+
+static void deselect()
+{
+	sbi(lcd->P_CS, lcd->B_CS);
+}
+
+// Sets a window with CS low and writes one pixel into its top left corner
+static void window(word x1, word y1, word x2, word y2, word color, const char *want)
+{
+	std::string	sent;
+
+	select();
+	lcd->setXY(x1, y1, x2, y2);
+	lcd->LCD_Write_DATA(color>>8, color & 0xFF);
+	deselect();
+	sent = commands();
+	TEST_ASSERT_EQUAL_STRING(want, sent.c_str());
+	TEST_ASSERT_EQUAL(color, panel->pixel(x1, y1));
+}
+
+void setUp()
+{
+	host_reset();
+	panel = new HostPanel(320, 480, HOST_BUS_16, LCD_CS, LCD_RS, LCD_WR);
+	lcd = new UTFT(ILI9486, LCD_RS, LCD_WR, LCD_CS, LCD_RST);
+	lcd->InitLCD(PORTRAIT);
+	panel->clearCounts();
+}
+
+void tearDown()
+{
+	delete lcd;
+	delete panel;
+}
+
+void test_cached()
+{
+	window(10, 20, 30, 40, 0x1111, "2A 2B 2C");
+	window(10, 20, 30, 40, 0x2222, "2C");
+	window(10, 50, 30, 60, 0x3333, "2B 2C");
+	window(70, 50, 90, 60, 0x4444, "2A 2C");
+	window(70, 50, 90, 60, 0x5555, "2C");
+}
+
+// Any other command may change what the controller holds
+void test_command()
+{
+	window(10, 20, 30, 40, 0x1111, "2A 2B 2C");
+	select();
+	lcd->LCD_Write_COM(0x00);			// NOP
+	deselect();
+	commands();
+	window(10, 20, 30, 40, 0x2222, "2A 2B 2C");
+
+	// Memory Access Control exchanges the meaning of columns and pages
+	select();
+	lcd->LCD_Write_COM(0x36);
+	lcd->LCD_Write_DATA(0x0A);
+	deselect();
+	commands();
+	window(10, 20, 30, 40, 0x3333, "2A 2B 2C");
+	window(10, 20, 30, 40, 0x4444, "2C");
+}
+
+// A window set while CS is high only reaches modules with CS tied low, so
+// the cache can't tell what this one holds. Toggling CS alone changes
+// nothing on the controller.
+void test_chip_select()
+{
+	window(10, 20, 30, 40, 0x1111, "2A 2B 2C");
+	select();
+	deselect();
+	select();
+	deselect();
+	window(10, 20, 30, 40, 0x2222, "2C");
+
+	lcd->clrXY();
+	TEST_ASSERT_EQUAL(0, panel->stream.size());
+	window(10, 20, 30, 40, 0x3333, "2A 2B 2C");
+
+	lcd->setXY(10, 20, 30, 40);
+	window(10, 20, 30, 40, 0x4444, "2A 2B 2C");
+}
+
+// What the drawing functions leave behind doesn't break the next one
+void test_drawing()
+{
+	lcd->setColor(VGA_RED);
+	lcd->fillRect(5, 5, 9, 9);
+	lcd->drawPixel(100, 100);
+	lcd->drawPixel(101, 100);
+	lcd->setColor(VGA_BLUE);
+	lcd->drawHLine(0, 200, 50);
+	lcd->drawPixel(7, 7);
+	TEST_ASSERT_EQUAL(VGA_RED, panel->pixel(5, 5));
+	TEST_ASSERT_EQUAL(VGA_RED, panel->pixel(9, 9));
+	TEST_ASSERT_EQUAL(VGA_BLUE, panel->pixel(7, 7));
+	TEST_ASSERT_EQUAL(VGA_RED, panel->pixel(100, 100));
+	TEST_ASSERT_EQUAL(VGA_RED, panel->pixel(101, 100));
+	TEST_ASSERT_EQUAL(VGA_BLUE, panel->pixel(50, 200));
+	TEST_ASSERT_EQUAL(0, panel->pixel(51, 200));
+}
+
+int main()
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_cached);
+	RUN_TEST(test_command);
+	RUN_TEST(test_chip_select);
+	RUN_TEST(test_drawing);
+	return UNITY_END();
+}